@@ -0,0 +1,99 @@
+/**
+ * @file binding_dispatch.cpp
+ * @brief Key binding lookup: the old std::unordered_map path against KeyboardListener's array + bitset
+ *
+ * Replays a stream of random Key codes (10% KEY_UNKNOWN, one third of the
+ * keys bound) through both and prints the best of several passes in
+ * nanoseconds per event.
+ *
+ * Usage: binding_dispatch [passes]
+ */
+
+#include <wma/input/keyboard/KeyboardListener.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace wma;
+
+namespace {
+
+    constexpr u32 EVENT_COUNT = 1u << 16;
+    constexpr u32 REPEATS = 400;
+
+    volatile u64 sink = 0;
+
+    /**
+     * @brief Exposes the backends' lookup; KeyboardListener has no pure virtuals
+     */
+    class TableListener final : public KeyboardListener {
+    public:
+        const KeyAction* find(i32 key) const { return findKeyAction(key); }
+    };
+
+    KeyAction makeAction() {
+        return KeyAction([]() { sink = sink + 1; }, []() { sink = sink + 1; });
+    }
+
+    template<typename Fn>
+    f64 nsPerEvent(const std::vector<i32>& events, Fn&& fn) {
+        const auto start = std::chrono::steady_clock::now();
+        for (u32 r = 0; r < REPEATS; ++r) {
+            for (const i32 key : events) {
+                fn(key);
+            }
+        }
+        const auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<f64, std::nano>(end - start).count() / (static_cast<f64>(REPEATS) * events.size());
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const i32 passes = argc > 1 ? INK_MAX(std::atoi(argv[1]), 1) : 5;
+
+    // Old layout: KeyboardListener::keyActions_ was a std::unordered_map<i32, KeyAction>
+    std::unordered_map<i32, KeyAction> map;
+    TableListener table;
+    for (i32 key = 0; key < KEY_COUNT; key += 3) {
+        map[key] = makeAction();
+        table.addKeyAction(key, makeAction());
+    }
+
+    std::mt19937 rng(1);
+    std::vector<i32> events(EVENT_COUNT);
+    for (i32& key : events) {
+        key = rng() % 10 == 0 ? KEY_UNKNOWN : static_cast<i32>(rng() % KEY_COUNT);
+    }
+
+    f64 mapDispatch = 1e9, tableDispatch = 1e9, mapLookup = 1e9, tableLookup = 1e9;
+    for (i32 pass = 0; pass < passes; ++pass) {
+        mapDispatch = std::min(mapDispatch, nsPerEvent(events, [&](i32 key) {
+            auto it = map.find(key);
+            if (it != map.end()) {
+                it->second.executePress(WMAKeyEvent(key, 0));
+            }
+        }));
+        tableDispatch = std::min(tableDispatch, nsPerEvent(events, [&](i32 key) {
+            if (const KeyAction* action = table.find(key)) {
+                action->executePress(WMAKeyEvent(key, 0));
+            }
+        }));
+        mapLookup = std::min(mapLookup, nsPerEvent(events, [&](i32 key) {
+            sink = sink + (map.find(key) != map.end());
+        }));
+        tableLookup = std::min(tableLookup, nsPerEvent(events, [&](i32 key) {
+            sink = sink + (table.find(key) != nullptr);
+        }));
+    }
+
+    std::printf("%-34s %14s %14s\n", "ns/event (best of passes)", "unordered_map", "array+bitset");
+    std::printf("%-34s %14.2f %14.2f\n", "dispatch (lookup + executePress)", mapDispatch, tableDispatch);
+    std::printf("%-34s %14.2f %14.2f\n", "lookup only", mapLookup, tableLookup);
+    return 0;
+}
@@ -0,0 +1,124 @@
+/**
+ * @file key_translation.cpp
+ * @brief Per-event key translation: the constexpr tables of Keys.h against the old switches
+ *
+ * First checks every table against its switch (LegacyKeyMaps.h) over the
+ * whole code range the backend can report and exits with 1 on any
+ * mismatch. Then replays 65536 random mapped codes per enabled backend
+ * and prints the best of several passes in nanoseconds per translation.
+ * Wayland is not covered: it had no translation before the evdev table.
+ *
+ * Usage: key_translation [passes]
+ */
+
+#include "LegacyKeyMaps.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <random>
+#include <vector>
+
+using namespace wma;
+
+namespace {
+
+    constexpr u32 EVENT_COUNT = 1u << 16;
+    constexpr u32 REPEATS = 300;
+
+    volatile i32 sink = 0;
+
+    template<typename Fn>
+    f64 nsPerEvent(const std::vector<i64>& codes, Fn&& fn) {
+        const auto start = std::chrono::steady_clock::now();
+        for (u32 r = 0; r < REPEATS; ++r) {
+            for (const i64 code : codes) {
+                sink = sink + static_cast<i32>(fn(code));
+            }
+        }
+        const auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<f64, std::nano>(end - start).count() / (static_cast<f64>(REPEATS) * codes.size());
+    }
+
+    /**
+     * @brief Codes a user actually types: drawn from the backend's mapped keys
+     */
+    template<size_t N>
+    std::vector<i64> sampleCodes(const detail::KeyMapping (&mappings)[N], std::mt19937& rng) {
+        std::vector<i64> codes(EVENT_COUNT);
+        for (i64& code : codes) {
+            code = static_cast<i64>(mappings[rng() % N].code);
+        }
+        return codes;
+    }
+
+    template<typename Table, typename Switch>
+    u64 countMismatches(const char* name, i64 first, i64 last, Table&& table, Switch&& reference) {
+        u64 mismatches = 0;
+        for (i64 code = first; code <= last; ++code) {
+            if (table(code) != reference(code)) {
+                if (mismatches++ < 8) {
+                    std::printf("%s: code 0x%llx maps to %d, switch says %d\n", name, static_cast<unsigned long long>(code),
+                                static_cast<i32>(table(code)), static_cast<i32>(reference(code)));
+                }
+            }
+        }
+        return mismatches;
+    }
+
+    template<typename Table, typename Switch>
+    void report(const char* name, const std::vector<i64>& codes, i32 passes, Table&& table, Switch&& reference) {
+        f64 switchNs = 1e9, tableNs = 1e9;
+        for (i32 pass = 0; pass < passes; ++pass) {
+            switchNs = std::min(switchNs, nsPerEvent(codes, reference));
+            tableNs = std::min(tableNs, nsPerEvent(codes, table));
+        }
+        std::printf("%-8s %10.2f %10.2f\n", name, switchNs, tableNs);
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const i32 passes = argc > 1 ? INK_MAX(std::atoi(argv[1]), 1) : 5;
+    u64 mismatches = 0;
+    std::mt19937 rng(7);
+
+    std::printf("%-8s %10s %10s   (ns/translation, best of passes)\n", "backend", "switch", "table");
+
+#ifdef WMA_ENABLE_GLFW
+    {
+        auto table = [](i64 code) { return mapGLFWKey(static_cast<int>(code)); };
+        auto reference = [](i64 code) { return legacy::mapGLFWKey(static_cast<int>(code)); };
+        mismatches += countMismatches("GLFW", -2, GLFW_KEY_LAST + 16, table, reference);
+        report("GLFW", sampleCodes(detail::glfwKeyMappings, rng), passes, table, reference);
+    }
+#endif
+
+#ifdef WMA_ENABLE_SDL
+    {
+        auto table = [](i64 code) { return mapSDLKey(static_cast<SDL_Keycode>(code)); };
+        auto reference = [](i64 code) { return legacy::mapSDLKey(static_cast<SDL_Keycode>(code)); };
+        mismatches += countMismatches("SDL", 0, 1023, table, reference);
+        mismatches += countMismatches("SDL", SDLK_SCANCODE_MASK, SDLK_SCANCODE_MASK | 1023, table, reference);
+        report("SDL", sampleCodes(detail::sdlKeyMappings, rng), passes, table, reference);
+    }
+#endif
+
+#ifdef WMA_ENABLE_X11
+    {
+        auto table = [](i64 code) { return mapX11Key(static_cast<KeySym>(code)); };
+        auto reference = [](i64 code) { return legacy::mapX11Key(static_cast<KeySym>(code)); };
+        mismatches += countMismatches("X11", 0, 0x1ffff, table, reference);
+        report("X11", sampleCodes(detail::keysymKeyMappings, rng), passes, table, reference);
+    }
+#endif
+
+    if (mismatches) {
+        std::printf("%llu codes translate differently from the switches\n", static_cast<unsigned long long>(mismatches));
+        return 1;
+    }
+    std::printf("tables match the switches\n");
+    return 0;
+}
@@ -0,0 +1,319 @@
+#ifndef WMA_CORE_FRAME_STATS_HPP
+#define WMA_CORE_FRAME_STATS_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <mutex>
+#include <ink/ink_base.hpp>
+
+#include "Types.hpp"
+
+#define WMA_FRAME_STATS_CAPACITY 256     // frames kept in the rolling window
+#define WMA_FRAME_STATS_JANK_FACTOR 2.0  // a frame longer than budget * factor counts as jank
+
+namespace wma {
+
+    /**
+     * @brief Time spent in each FramePhase during one frame (milliseconds)
+     */
+    struct FramePhaseTimes {
+        std::array<f64, PhaseCount> ms{};
+
+        f64& operator[](FramePhase phase) { return ms[phase]; }
+        f64 operator[](FramePhase phase) const { return ms[phase]; }
+    };
+
+    /**
+     * @brief Aggregated durations of one FramePhase (milliseconds)
+     */
+    struct FramePhaseSummary {
+        f64 last = 0.0;     // Most recent frame
+        f64 average = 0.0;  // Mean since the last reset
+        f64 max = 0.0;      // Worst frame since the last reset
+        f64 total = 0.0;    // Sum since the last reset
+    };
+
+    /**
+     * @brief Point-in-time copy of the rolling frame-time window (milliseconds)
+     */
+    struct FrameStatsSnapshot {
+        u32 sampleCount = 0;       // Frames currently in the window
+        u64 totalFrames = 0;       // Frames recorded since the last reset
+        u64 overBudgetFrames = 0;  // Frames longer than the budget since the last reset
+        u64 jankFrames = 0;        // Frames longer than budget * WMA_FRAME_STATS_JANK_FACTOR since the last reset
+        u32 overBudgetInWindow = 0;
+        f64 budget = 0.0;          // Target frame time, 0 when uncapped
+        f64 last = 0.0;
+        f64 average = 0.0;
+        f64 p50 = 0.0;
+        f64 p95 = 0.0;
+        f64 p99 = 0.0;
+        f64 max = 0.0;
+        u64 phaseFrames = 0;  // Frames with a phase breakdown since the last reset
+        std::array<FramePhaseSummary, PhaseCount> phases{};
+    };
+
+    /**
+     * @brief Fixed-size, allocation-free ring buffer of recent frame times
+     *
+     * Written once per frame by FrameTimer. Every accessor takes an internal
+     * lock, so the window can be snapshotted from any thread; the O(1)
+     * accessors stay cheap enough to call from inside the process() callback.
+     */
+    class FrameStats {
+    public:
+        FrameStats() = default;
+
+        FrameStats(const FrameStats& other) {
+            std::lock_guard<std::mutex> lock(other.mutex_);
+            copyFrom(other);
+        }
+
+        FrameStats& operator=(const FrameStats& other) {
+            if (this != &other) {
+                std::scoped_lock lock(mutex_, other.mutex_);
+                copyFrom(other);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Set the frame budget used by the over-budget and jank counters
+         * @param budgetMs Target frame time in ms (0 disables both counters)
+         */
+        void setBudget(f64 budgetMs) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            budget_ = budgetMs;
+        }
+
+        /**
+         * @brief Record one frame time
+         * @param frameTimeMs Frame duration in ms
+         */
+        void push(f64 frameTimeMs) {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            if (count_ == WMA_FRAME_STATS_CAPACITY) {
+                windowSum_ -= samples_[head_];
+            } else {
+                ++count_;
+            }
+
+            samples_[head_] = static_cast<f32>(frameTimeMs);
+            windowSum_ += samples_[head_];
+            head_ = (head_ + 1) % WMA_FRAME_STATS_CAPACITY;
+
+            ++totalFrames_;
+            if (budget_ > 0.0 && frameTimeMs > budget_) {
+                ++overBudgetFrames_;
+                if (frameTimeMs > budget_ * WMA_FRAME_STATS_JANK_FACTOR) {
+                    ++jankFrames_;
+                }
+            }
+        }
+
+        /**
+         * @brief Record the phase breakdown of one frame
+         * @param times Time spent in each phase in ms
+         */
+        void pushPhases(const FramePhaseTimes& times) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            lastPhases_ = times;
+            ++phaseFrames_;
+            for (i32 i = 0; i < PhaseCount; ++i) {
+                phaseTotals_.ms[i] += times.ms[i];
+                phaseMax_.ms[i] = std::max(phaseMax_.ms[i], times.ms[i]);
+            }
+        }
+
+        /**
+         * @brief Phase breakdown of the most recent frame
+         */
+        FramePhaseTimes lastPhases() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return lastPhases_;
+        }
+
+        /**
+         * @brief Drop every sample and counter (the budget is kept)
+         */
+        void reset() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            head_ = 0;
+            count_ = 0;
+            windowSum_ = 0.0;
+            totalFrames_ = 0;
+            overBudgetFrames_ = 0;
+            jankFrames_ = 0;
+            phaseFrames_ = 0;
+            lastPhases_ = FramePhaseTimes{};
+            phaseTotals_ = FramePhaseTimes{};
+            phaseMax_ = FramePhaseTimes{};
+        }
+
+        u32 size() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return count_;
+        }
+
+        /**
+         * @brief Most recent frame time in ms
+         */
+        f64 last() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return count_ ? samples_[newestIndex(0)] : 0.0;
+        }
+
+        /**
+         * @brief Average frame time over the whole window in ms
+         */
+        f64 average() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return count_ ? windowSum_ / count_ : 0.0;
+        }
+
+        /**
+         * @brief Average frame time over the newest frames in ms
+         * @param frames Sliding window length (clamped to the samples available)
+         */
+        f64 average(u32 frames) const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            const u32 n = std::min(frames, count_);
+            if (n == 0) return 0.0;
+
+            f64 sum = 0.0;
+            for (u32 i = 0; i < n; ++i) {
+                sum += samples_[newestIndex(i)];
+            }
+            return sum / n;
+        }
+
+        u64 overBudgetFrames() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return overBudgetFrames_;
+        }
+
+        u64 jankFrames() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return jankFrames_;
+        }
+
+        /**
+         * @brief Nearest-rank percentile of the window in ms, O(n)
+         * @param p Percentile in [0, 1]
+         */
+        f64 percentile(f64 p) const {
+            std::array<f32, WMA_FRAME_STATS_CAPACITY> sorted;
+            u32 n;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                n = count_;
+                std::copy_n(samples_.begin(), n, sorted.begin());
+            }
+            if (n == 0) return 0.0;
+
+            const u32 k = rankIndex(p, n);
+            std::nth_element(sorted.begin(), sorted.begin() + k, sorted.begin() + n);
+            return sorted[k];
+        }
+
+        /**
+         * @brief Copy the window and compute every statistic at once
+         */
+        FrameStatsSnapshot snapshot() const {
+            FrameStatsSnapshot snap;
+            std::array<f32, WMA_FRAME_STATS_CAPACITY> sorted;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                snap.sampleCount = count_;
+                snap.totalFrames = totalFrames_;
+                snap.overBudgetFrames = overBudgetFrames_;
+                snap.jankFrames = jankFrames_;
+                snap.budget = budget_;
+                snap.average = count_ ? windowSum_ / count_ : 0.0;
+                snap.last = count_ ? samples_[newestIndex(0)] : 0.0;
+                std::copy_n(samples_.begin(), count_, sorted.begin());
+
+                snap.phaseFrames = phaseFrames_;
+                for (i32 i = 0; i < PhaseCount; ++i) {
+                    FramePhaseSummary& phase = snap.phases[i];
+                    phase.last = lastPhases_.ms[i];
+                    phase.total = phaseTotals_.ms[i];
+                    phase.max = phaseMax_.ms[i];
+                    phase.average = phaseFrames_ ? phaseTotals_.ms[i] / phaseFrames_ : 0.0;
+                }
+            }
+
+            const u32 n = snap.sampleCount;
+            if (n == 0) return snap;
+
+            auto first = sorted.begin();
+            auto end = sorted.begin() + n;
+
+            if (snap.budget > 0.0) {
+                snap.overBudgetInWindow = static_cast<u32>(std::count_if(first, end,
+                    [&](f32 v) { return v > snap.budget; }));
+            }
+
+            // Each nth_element partitions the tail for the next, larger rank
+            const u32 k50 = rankIndex(0.50, n);
+            const u32 k95 = rankIndex(0.95, n);
+            const u32 k99 = rankIndex(0.99, n);
+
+            std::nth_element(first, first + k50, end);
+            snap.p50 = sorted[k50];
+            std::nth_element(first + k50, first + k95, end);
+            snap.p95 = sorted[k95];
+            std::nth_element(first + k95, first + k99, end);
+            snap.p99 = sorted[k99];
+            snap.max = *std::max_element(first + k99, end);
+
+            return snap;
+        }
+
+    private:
+        mutable std::mutex mutex_;
+        std::array<f32, WMA_FRAME_STATS_CAPACITY> samples_{};
+        u32 head_ = 0;
+        u32 count_ = 0;
+        f64 windowSum_ = 0.0;
+        f64 budget_ = 0.0;
+        u64 totalFrames_ = 0;
+        u64 overBudgetFrames_ = 0;
+        u64 jankFrames_ = 0;
+
+        u64 phaseFrames_ = 0;
+        FramePhaseTimes lastPhases_;
+        FramePhaseTimes phaseTotals_;
+        FramePhaseTimes phaseMax_;
+
+        // i = 0 is the newest sample
+        u32 newestIndex(u32 i) const {
+            return (head_ + WMA_FRAME_STATS_CAPACITY - 1 - i) % WMA_FRAME_STATS_CAPACITY;
+        }
+
+        static u32 rankIndex(f64 p, u32 n) {
+            const f64 rank = std::ceil(std::clamp(p, 0.0, 1.0) * n);
+            return rank < 1.0 ? 0 : static_cast<u32>(rank) - 1;
+        }
+
+        void copyFrom(const FrameStats& other) {
+            samples_ = other.samples_;
+            head_ = other.head_;
+            count_ = other.count_;
+            windowSum_ = other.windowSum_;
+            budget_ = other.budget_;
+            totalFrames_ = other.totalFrames_;
+            overBudgetFrames_ = other.overBudgetFrames_;
+            jankFrames_ = other.jankFrames_;
+            phaseFrames_ = other.phaseFrames_;
+            lastPhases_ = other.lastPhases_;
+            phaseTotals_ = other.phaseTotals_;
+            phaseMax_ = other.phaseMax_;
+        }
+    };
+
+} // namespace wma
+
+#endif // WMA_CORE_FRAME_STATS_HPP
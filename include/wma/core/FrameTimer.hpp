@@ -1,30 +1,70 @@
 #ifndef FRAMETIMER_H
 #define FRAMETIMER_H
 
-#include <mutex>
-#include <condition_variable>
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <thread>
 #include <ink/ink_base.hpp>
 
+#ifdef __linux__
+#include <cerrno>
+#include <ctime>
+#include <sys/prctl.h>
+#endif
+
+#include "Types.hpp"
+#include "WindowDetails.hpp"
 #include "WindowFlags.hpp"
 
 #define LIMIT_TARGET_FPS_TOLERANCE 1e-5
-#define LIMIT_SPIN_LOOP_DURATION 2e-3
+#define LIMIT_SPIN_LOOP_DURATION 2e-6      // seconds (FixedSpin window: the 2 us the original limiter spun)
+#define LIMIT_SPIN_LOOP_MIN_DURATION 5e-5  // seconds (AdaptiveSpin lower bound)
+#define LIMIT_SPIN_LOOP_MAX_DURATION 2e-3  // seconds (AdaptiveSpin upper bound)
+#define LIMIT_OVERSHOOT_EWMA_WEIGHT 0.1
+#define LIMIT_OVERSHOOT_STDDEV_MARGIN 3.0
+#define LIMIT_MAX_CATCHUP_FRAMES 4         // CatchUp resyncs once it falls further behind than this
 
 namespace wma {
 
 class FrameTimer {
 public:
-    WindowFlags& windowFlags_;
+    // Must stay steady: Deadline pacing sleeps on CLOCK_MONOTONIC with these time points
+    using Clock = std::chrono::steady_clock;
+
+    WindowFlags* windowFlags_;
 
     // Ex: ~60 FPS (1000ms / 60 ≈ 16.66ms)
     std::chrono::duration<f64, std::milli> targetFrameTime_{0.0}; // Ilimitado
 
     FrameTimer(WindowFlags& wFlags)
-        : windowFlags_(wFlags),
-        lastFrameTime_(std::chrono::high_resolution_clock::now()),
-        frameStartTime_(lastFrameTime_) {}
+        : windowFlags_(&wFlags),
+        lastFrameTime_(Clock::now()),
+        frameStartTime_(lastFrameTime_),
+        phaseMark_(lastFrameTime_) {}
+
+    /**
+     * @brief Point the timer at another WindowFlags (after its owner was moved)
+     */
+    void bind(WindowFlags& wFlags) {
+        windowFlags_ = &wFlags;
+        windowFlags_->frameStats.setBudget(targetFrameTime_.count());
+    }
+
+    /**
+     * @brief Apply the pacing related fields of a window configuration
+     * @param details Window configuration (targetFPS, framePacing, frameOverrun, timerSlackNs, idle mode)
+     */
+    void configure(const WindowDetails& details) {
+        setTargetFPS(details.targetFPS > 0 ? static_cast<unsigned int>(details.targetFPS) : 0);
+        setPacing(details.framePacing);
+        setOverrunPolicy(details.frameOverrun);
+        if (details.timerSlackNs > 0) {
+            setTimerSlack(details.timerSlackNs);
+        }
+        idleWhenInactive_ = details.idleWhenInactive;
+        backgroundFPS_ = details.backgroundFPS > 0 ? details.backgroundFPS : 0;
+    }
 
     void setTargetFPS(unsigned int fps) {
         if (fps > 0) {
@@ -32,44 +72,297 @@ public:
         } else {
             targetFrameTime_ = std::chrono::duration<f64, std::milli>(0.0);
         }
+        windowFlags_->frameStats.setBudget(targetFrameTime_.count());
+        timelineValid_ = false;
+    }
+
+    void setPacing(FramePacing pacing) {
+        pacing_ = pacing;
+        timelineValid_ = false;
+    }
+
+    FramePacing getPacing() const {
+        return pacing_;
+    }
+
+    /**
+     * @brief Choose how Deadline pacing recovers after a frame overruns its slot
+     */
+    void setOverrunPolicy(FrameOverrun policy) {
+        overrun_ = policy;
+    }
+
+    FrameOverrun getOverrunPolicy() const {
+        return overrun_;
+    }
+
+    /**
+     * @brief Set the kernel timer slack of the calling thread (PR_SET_TIMERSLACK)
+     *
+     * A small slack lets the kernel wake the pacing sleep closer to the requested
+     * time, which in turn shrinks the adaptive spin window. No-op off Linux.
+     *
+     * @param nanoseconds Slack in ns
+     * @return true if the slack was applied
+     */
+    bool setTimerSlack(u64 nanoseconds) {
+#ifdef __linux__
+        return prctl(PR_SET_TIMERSLACK, static_cast<unsigned long>(nanoseconds), 0, 0, 0) == 0;
+#else
+        (void)nanoseconds;
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Current busy-wait window in seconds
+     */
+    f64 getSpinWindow() const {
+        if (pacing_ == FramePacing::FixedSpin) {
+            return LIMIT_SPIN_LOOP_DURATION;
+        }
+
+        const f64 estimate = overshootMean_ + LIMIT_OVERSHOOT_STDDEV_MARGIN * std::sqrt(overshootVariance_);
+        return std::clamp(estimate, LIMIT_SPIN_LOOP_MIN_DURATION, LIMIT_SPIN_LOOP_MAX_DURATION);
+    }
+
+    /**
+     * @brief Whether the loop should block on input instead of rendering the next frame
+     *
+     * True when WindowFlags::idle is set, or when idleWhenInactive is enabled and
+     * the window is minimized or unfocused.
+     */
+    bool shouldIdle() const {
+        return windowFlags_->idle ||
+               (idleWhenInactive_ && (windowFlags_->minimized || !windowFlags_->focused));
+    }
+
+    /**
+     * @brief Longest idle wait in ms, -1 to block until an event (backgroundFPS == 0)
+     */
+    i32 getIdleTimeoutMs() const {
+        if (backgroundFPS_ <= 0) {
+            return -1;
+        }
+        return static_cast<i32>(std::ceil(1000.0 / backgroundFPS_));
+    }
+
+    /**
+     * @brief Tell the timer the loop just returned from an idle wait
+     *
+     * The next frame is not recorded in frameStats (its delta includes the wait)
+     * and the Deadline timeline restarts instead of catching up.
+     */
+    void markIdle() {
+        idleFrame_ = true;
+        timelineValid_ = false;
+    }
+
+    /**
+     * @brief Sleep on an absolute CLOCK_MONOTONIC deadline so wake-up error never accumulates
+     */
+    static void sleepUntil(Clock::time_point wakeTarget) {
+#ifdef __linux__
+        const auto sinceEpoch = std::chrono::duration_cast<std::chrono::nanoseconds>(wakeTarget.time_since_epoch());
+
+        timespec ts;
+        ts.tv_sec = static_cast<time_t>(sinceEpoch.count() / 1000000000);
+        ts.tv_nsec = static_cast<long>(sinceEpoch.count() % 1000000000);
+
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) {
+            // Restart after signals; the deadline is absolute
+        }
+#else
+        std::this_thread::sleep_until(wakeTarget);
+#endif
     }
 
     /**
      * @brief Chame no início do loop principal. Calcula deltaTime e FPS.
      */
     void updateDeltaTime() {
-        frameStartTime_ = std::chrono::high_resolution_clock::now();
+        frameStartTime_ = Clock::now();
+        inFrame_ = true;
+        phaseMark_ = frameStartTime_;
+        phases_ = FramePhaseTimes{};
+    }
+
+    /**
+     * @brief Close a phase: charge the time since the previous mark to it
+     *
+     * Marks accumulate, so a phase split across the frame (e.g. clear before
+     * and swap after the user actions) can be marked more than once.
+     * Ignored outside a frame (before updateDeltaTime / after limitFrameRate).
+     *
+     * @param phase The phase that just finished
+     */
+    void markPhase(FramePhase phase) {
+        if (!inFrame_) return;
+
+        const Clock::time_point now = Clock::now();
+        phases_[phase] += std::chrono::duration<f64, std::milli>(now - phaseMark_).count();
+        phaseMark_ = now;
+    }
+
+    /**
+     * @brief Whether a frame is open (updateDeltaTime called, limitFrameRate not yet)
+     */
+    bool inFrame() const {
+        return inFrame_;
     }
 
     /**
      * @brief Chame no final do loop principal. Dorme se o frame terminar antes do tempo alvo.
      */
     void limitFrameRate() {
+        limitFrameRate(&FrameTimer::sleepUntil);
+    }
+
+    /**
+     * @brief limitFrameRate() with a custom wait for the sleep part of the pacing
+     *
+     * Lets a backend wait on its display connection instead of sleeping blindly.
+     * The spin window that follows is unchanged.
+     *
+     * @param sleep Callable void(Clock::time_point wakeTarget); should return close to wakeTarget
+     */
+    template <typename SleepFn>
+    void limitFrameRate(SleepFn&& sleep) {
         std::chrono::duration<f64, std::milli> elapsed = frameStartTime_ - lastFrameTime_;
 
-        windowFlags_.deltaTime = INK_MAX(elapsed.count(), LIMIT_TARGET_FPS_TOLERANCE);
-        windowFlags_.fps = 1000.0 / windowFlags_.deltaTime;
+        windowFlags_->deltaTime = INK_MAX(elapsed.count(), LIMIT_TARGET_FPS_TOLERANCE);
+        windowFlags_->fps = 1000.0 / windowFlags_->deltaTime;
+        lastFrameTime_ = frameStartTime_;
 
-        lastFrameTime_ = std::move(frameStartTime_);
+        phaseMark_ = Clock::now();
+        pace(sleep);
+        markPhase(FramePhase::PhaseSleep);
+        inFrame_ = false;
 
-        std::chrono::duration<f64, std::milli> remaining = targetFrameTime_ - (std::chrono::high_resolution_clock::now() - frameStartTime_);
+        if (!idleFrame_) {
+            windowFlags_->frameStats.push(windowFlags_->deltaTime);
+            windowFlags_->frameStats.pushPhases(phases_);
+        }
+        idleFrame_ = false;
+    }
 
-        if (remaining.count() > LIMIT_SPIN_LOOP_DURATION) {
-            std::this_thread::sleep_for(remaining-std::chrono::duration<f64, std::milli>(LIMIT_SPIN_LOOP_DURATION));
+private:
+    Clock::time_point lastFrameTime_;
+    Clock::time_point frameStartTime_;
+
+    FramePacing pacing_ = FramePacing::AdaptiveSpin;
+    FrameOverrun overrun_ = FrameOverrun::SkipMissed;
+
+    // Idle mode (event-driven while inactive)
+    bool idleWhenInactive_ = false;
+    i32 backgroundFPS_ = 0;
+    bool idleFrame_ = false;
+
+    // Per-phase timing of the current frame
+    bool inFrame_ = false;
+    Clock::time_point phaseMark_;
+    FramePhaseTimes phases_;
+
+    // Absolute frame timeline used by Deadline pacing
+    Clock::time_point nextDeadline_;
+    bool timelineValid_ = false;
+
+    // Running estimate of how late the pacing sleep wakes up on this host (seconds), seeded at the floor so the first frames do not spin for 2 ms
+    f64 overshootMean_ = LIMIT_SPIN_LOOP_MIN_DURATION;
+    f64 overshootVariance_ = 0.0;
+
+    /**
+     * @brief Wait for the end of the current frame slot according to the pacing mode
+     */
+    template <typename SleepFn>
+    void pace(SleepFn& sleep) {
+        if (targetFrameTime_.count() <= 0.0) {
+            return;
+        }
+
+        const auto period = std::chrono::duration_cast<Clock::duration>(targetFrameTime_);
+
+        if (pacing_ != FramePacing::Deadline) {
+            waitUntil(frameStartTime_ + period, sleep);
+            return;
         }
 
-        while ((std::chrono::high_resolution_clock::now() - frameStartTime_) < targetFrameTime_)
+        if (advanceTimeline(period)) {
+            waitUntil(nextDeadline_, sleep);
+        }
+    }
+
+    /**
+     * @brief Move the Deadline timeline to this frame's slot, applying the overrun policy
+     * @return false if the frame is already late and should not wait at all
+     */
+    bool advanceTimeline(Clock::duration period) {
+        if (!timelineValid_) {
+            nextDeadline_ = frameStartTime_ + period;
+            timelineValid_ = true;
+        } else {
+            nextDeadline_ += period;
+        }
+
+        const Clock::time_point now = Clock::now();
+        if (now < nextDeadline_) {
+            return true;
+        }
+
+        const Clock::duration lag = now - nextDeadline_;
+
+        if (overrun_ == FrameOverrun::CatchUp && lag < period * LIMIT_MAX_CATCHUP_FRAMES) {
+            // Keep the timeline; the following frames run back-to-back until they are ahead again
+            return false;
+        }
+
+        if (overrun_ == FrameOverrun::CatchUp) {
+            // Too far behind to catch up: restart the timeline from here
+            nextDeadline_ = now;
+            return false;
+        }
+
+        // SkipMissed: drop the missed slots and wait for the next one on the grid
+        nextDeadline_ += period * (lag / period + 1);
+        return true;
+    }
+
+    /**
+     * @brief Sleep until the spin window opens, then busy-wait up to the deadline
+     */
+    template <typename SleepFn>
+    void waitUntil(Clock::time_point deadline, SleepFn& sleep) {
+        const auto spinWindow = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<f64>(getSpinWindow()));
+
+        const Clock::time_point wakeTarget = deadline - spinWindow;
+
+        if (Clock::now() < wakeTarget) {
+            sleep(wakeTarget);
+
+            if (pacing_ != FramePacing::FixedSpin) {
+                const std::chrono::duration<f64> overshoot = Clock::now() - wakeTarget;
+                recordSleepOvershoot(overshoot.count());
+            }
+        }
+
+        while (Clock::now() < deadline)
         {
             // Busy waiting
         }
     }
 
-private:
-    std::chrono::high_resolution_clock::time_point lastFrameTime_;
-    std::chrono::high_resolution_clock::time_point frameStartTime_;
+    /**
+     * @brief Fold one observed sleep overshoot into the EWMA mean/variance
+     */
+    void recordSleepOvershoot(f64 overshoot) {
+        const f64 sample = INK_MAX(overshoot, 0.0);
+        const f64 diff = sample - overshootMean_;
 
-    std::mutex mt_;
-    std::condition_variable cv_;
+        overshootMean_ += LIMIT_OVERSHOOT_EWMA_WEIGHT * diff;
+        overshootVariance_ = (1.0 - LIMIT_OVERSHOOT_EWMA_WEIGHT) *
+                             (overshootVariance_ + LIMIT_OVERSHOOT_EWMA_WEIGHT * diff * diff);
+    }
 };
 
 }
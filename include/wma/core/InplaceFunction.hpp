@@ -0,0 +1,171 @@
+#ifndef WMA_CORE_INPLACE_FUNCTION_HPP
+#define WMA_CORE_INPLACE_FUNCTION_HPP
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <ink/ink_base.hpp>
+
+// Bytes of captured state an input callback stores inline. It sets the layout of KeyAction, MouseAction and the
+// listeners' binding tables, so it must match the library build: set the WMA_CALLBACK_CAPACITY CMake option, which
+// exports it to every target linking wma, rather than defining it in the application alone
+#ifndef WMA_CALLBACK_CAPACITY
+#define WMA_CALLBACK_CAPACITY 24
+#endif
+
+namespace wma {
+
+    template <typename Signature, size_t Capacity = WMA_CALLBACK_CAPACITY>
+    class InplaceFunction;
+
+    /**
+     * @brief Fixed-capacity callable that never allocates
+     *
+     * Replaces std::function on the input dispatch paths: the callable lives in
+     * an inline buffer (a too large capture is a compile error, not a heap
+     * allocation) next to one pointer to a static per-type table of its call
+     * and copy/move/destroy functions, so the object is Capacity + 8 bytes. Plain function pointers work too, so "function + context"
+     * bindings are just a lambda capturing the context.
+     *
+     * Calling an empty InplaceFunction throws std::bad_function_call, like std::function.
+     *
+     * @tparam R(Args...) Call signature
+     * @tparam Capacity Inline storage in bytes
+     */
+    template <typename R, typename... Args, size_t Capacity>
+    class InplaceFunction<R(Args...), Capacity> {
+    public:
+        InplaceFunction() noexcept = default;
+        InplaceFunction(std::nullptr_t) noexcept {}
+
+        template <typename F, typename D = std::decay_t<F>,
+                  typename = std::enable_if_t<!std::is_same<D, InplaceFunction>::value &&
+                                              std::is_invocable_r<R, D&, Args...>::value>>
+        InplaceFunction(F&& callable) {
+            static_assert(sizeof(D) <= Capacity, "Callable does not fit InplaceFunction: capture less, bind through a context pointer, or rebuild wma with a larger WMA_CALLBACK_CAPACITY");
+            static_assert(alignof(D) <= alignof(void*), "Over-aligned callable");
+            static_assert(std::is_nothrow_move_constructible<D>::value, "Callable must be nothrow move constructible");
+            static_assert(std::is_copy_constructible<D>::value, "Callable must be copy constructible");
+
+            if constexpr (std::is_pointer<D>::value || std::is_member_pointer<D>::value) {
+                if (callable == nullptr) {
+                    return;
+                }
+            }
+
+            ::new (static_cast<void*>(storage_)) D(std::forward<F>(callable));
+            ops_ = &storedOps<D>;
+        }
+
+        InplaceFunction(const InplaceFunction& other) {
+            if (other.ops_ != &emptyOps) {
+                other.ops_->manage(Operation::Copy, storage_, const_cast<unsigned char*>(other.storage_));
+                ops_ = other.ops_;
+            }
+        }
+
+        InplaceFunction(InplaceFunction&& other) noexcept {
+            moveFrom(other);
+        }
+
+        ~InplaceFunction() {
+            reset();
+        }
+
+        InplaceFunction& operator=(const InplaceFunction& other) {
+            if (this != &other) {
+                InplaceFunction copy(other);
+                reset();
+                moveFrom(copy);
+            }
+            return *this;
+        }
+
+        InplaceFunction& operator=(InplaceFunction&& other) noexcept {
+            if (this != &other) {
+                reset();
+                moveFrom(other);
+            }
+            return *this;
+        }
+
+        InplaceFunction& operator=(std::nullptr_t) noexcept {
+            reset();
+            return *this;
+        }
+
+        explicit operator bool() const noexcept { return ops_ != &emptyOps; }
+
+        R operator()(Args... args) const {
+            return ops_->invoke(const_cast<unsigned char*>(storage_), std::forward<Args>(args)...);
+        }
+
+    private:
+        enum class Operation { Copy, Move, Destroy };
+
+        using Invoker = R (*)(void* storage, Args&&... args);
+        using Manager = void (*)(Operation operation, void* destination, void* source);
+
+        struct Ops {
+            Invoker invoke;
+            Manager manage;
+        };
+
+        alignas(void*) unsigned char storage_[Capacity];  // Pointer alignment keeps the object at Capacity + 8 bytes
+        const Ops* ops_ = &emptyOps;
+
+        template <typename D>
+        static R invokeStored(void* storage, Args&&... args) {
+            return std::invoke(*static_cast<D*>(storage), std::forward<Args>(args)...);
+        }
+
+        static R invokeEmpty(void*, Args&&...) {
+            throw std::bad_function_call();
+        }
+
+        template <typename D>
+        static void manageStored(Operation operation, void* destination, void* source) {
+            switch (operation) {
+            case Operation::Copy:
+                ::new (destination) D(*static_cast<const D*>(source));
+                break;
+            case Operation::Move:
+                ::new (destination) D(std::move(*static_cast<D*>(source)));
+                static_cast<D*>(source)->~D();
+                break;
+            case Operation::Destroy:
+                static_cast<D*>(destination)->~D();
+                break;
+            }
+        }
+
+        static void manageEmpty(Operation, void*, void*) {}
+
+        // One table per stored type, shared by every InplaceFunction holding it; emptyOps marks "no callable"
+        static constexpr Ops emptyOps{&invokeEmpty, &manageEmpty};
+
+        template <typename D>
+        static constexpr Ops storedOps{&invokeStored<D>, &manageStored<D>};
+
+        // Leaves other empty
+        void moveFrom(InplaceFunction& other) noexcept {
+            if (other.ops_ != &emptyOps) {
+                other.ops_->manage(Operation::Move, storage_, other.storage_);
+                ops_ = other.ops_;
+                other.ops_ = &emptyOps;
+            }
+        }
+
+        void reset() noexcept {
+            if (ops_ != &emptyOps) {
+                ops_->manage(Operation::Destroy, storage_, nullptr);
+                ops_ = &emptyOps;
+            }
+        }
+    };
+
+} // namespace wma
+
+#endif // WMA_CORE_INPLACE_FUNCTION_HPP
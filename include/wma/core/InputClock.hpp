@@ -0,0 +1,120 @@
+#ifndef WMA_CORE_INPUT_CLOCK_HPP
+#define WMA_CORE_INPUT_CLOCK_HPP
+
+#include <chrono>
+#include <ink/ink_base.hpp>
+
+#ifndef WMA_INPUT_CLOCK_SLEW
+#define WMA_INPUT_CLOCK_SLEW 1e-4          // offset drift allowed per elapsed time (100 ppm) for device clocks of another domain
+#endif
+
+#ifndef WMA_INPUT_CLOCK_RESYNC_MS
+#define WMA_INPUT_CLOCK_RESYNC_MS 5000.0   // an event older than this on arrival means the device clock jumped
+#endif
+
+namespace wma {
+
+    /**
+     * @brief Common clock of every input timestamp: nanoseconds of std::chrono::steady_clock
+     *
+     * CLOCK_MONOTONIC on Linux, the clock FrameTimer and Reactor run on, so
+     * event times compare directly with frame times.
+     */
+    using InputClock = std::chrono::steady_clock;
+
+    inline u64 inputTimeNow() {
+        return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            InputClock::now().time_since_epoch()).count());
+    }
+
+    /**
+     * @brief Milliseconds between an event timestamp and now, e.g. at the top of a callback
+     */
+    inline f64 inputAgeMs(u64 timestamp, u64 now = inputTimeNow()) {
+        return (static_cast<f64>(now) - static_cast<f64>(timestamp)) * 1e-6;
+    }
+
+    /**
+     * @brief Maps one device clock (X server time, wl_pointer time, SDL ticks) onto InputClock
+     *
+     * Device times are unwrapped from their bit width, scaled to
+     * nanoseconds and shifted by an offset measured against the arrival
+     * time of each event:
+     * - A device clock that already is CLOCK_MONOTONIC (the X server and
+     *   Wayland compositors on Linux) is used as is, so ages are the real
+     *   latency.
+     * - Any other clock is shifted by the smallest (arrival - device time)
+     *   seen, which slowly creeps up to follow drift: ages are then the
+     *   latency above the best case.
+     *
+     * A mapped time never lies after the arrival of its event.
+     */
+    class InputClockMapper {
+    public:
+        /**
+         * @param unitNs Nanoseconds per device tick (1000000 for milliseconds)
+         * @param bits Width of the device timestamp; it wraps at 2^bits ticks
+         */
+        explicit InputClockMapper(u64 unitNs = 1000000, u32 bits = 32)
+            : unitNs_(static_cast<i64>(unitNs)), shift_(64 - bits) {}
+
+        /**
+         * @brief Convert a device timestamp
+         * @param deviceTime Raw timestamp of the event
+         * @param arrival When the event reached the listener (InputClock ns)
+         * @return Event time on InputClock in nanoseconds
+         */
+        u64 map(u64 deviceTime, u64 arrival = inputTimeNow()) {
+            // Sign extending the wrapped difference handles both wraparound and slightly out of order events
+            if (synced_) {
+                ticks_ += static_cast<i64>((deviceTime - lastRaw_) << shift_) >> shift_;
+            } else {
+                ticks_ = static_cast<i64>((deviceTime << shift_) >> shift_);
+            }
+            lastRaw_ = deviceTime;
+
+            const i64 deviceNs = ticks_ * unitNs_;
+            const i64 latency = static_cast<i64>(arrival) - deviceNs;  // Offset that would make this event arrive instantly
+            const i64 resync = static_cast<i64>(WMA_INPUT_CLOCK_RESYNC_MS * 1e6);
+
+            if (!synced_ || latency - offset_ > resync) {
+                // First event or a jump of the device clock: a clock on the same timeline as ours lags by under resync
+                sameDomain_ = latency >= 0 && latency < resync;
+                offset_ = sameDomain_ ? 0 : latency;
+                synced_ = true;
+            } else if (latency < offset_) {
+                // Event from the future: not our timeline after all, or a better best case
+                if (latency < -unitNs_) {
+                    sameDomain_ = false;
+                }
+                offset_ = latency;
+            } else if (!sameDomain_) {
+                const i64 slew = static_cast<i64>(static_cast<f64>(static_cast<i64>(arrival - lastArrival_)) * WMA_INPUT_CLOCK_SLEW);
+                offset_ = INK_MIN(latency, offset_ + slew);
+            }
+            lastArrival_ = arrival;
+
+            return static_cast<u64>(deviceNs + offset_);
+        }
+
+        /**
+         * @brief Forget the offset, e.g. after the device clock restarted
+         */
+        void reset() { synced_ = false; }
+
+        bool isSameDomain() const { return synced_ && sameDomain_; }
+
+    private:
+        i64 unitNs_;
+        u32 shift_;
+        u64 lastRaw_ = 0;
+        i64 ticks_ = 0;
+        i64 offset_ = 0;
+        u64 lastArrival_ = 0;
+        bool synced_ = false;
+        bool sameDomain_ = false;
+    };
+
+} // namespace wma
+
+#endif // WMA_CORE_INPUT_CLOCK_HPP
@@ -0,0 +1,204 @@
+#ifndef WMA_CORE_LATENCY_HISTOGRAM_HPP
+#define WMA_CORE_LATENCY_HISTOGRAM_HPP
+
+#include <array>
+#include <atomic>
+#include <ink/ink_base.hpp>
+
+#include "InputClock.hpp"
+
+#ifndef WMA_LATENCY_OCTAVES
+#define WMA_LATENCY_OCTAVES 24          // powers of two of microseconds covered; longer waits land in the last bucket (~33 s)
+#endif
+
+#ifndef WMA_LATENCY_SUB_BUCKET_BITS
+#define WMA_LATENCY_SUB_BUCKET_BITS 2   // 4 linear steps per octave: a bucket spans at most 25% of its lower bound
+#endif
+
+#define WMA_LATENCY_BUCKETS (WMA_LATENCY_OCTAVES << WMA_LATENCY_SUB_BUCKET_BITS)
+
+namespace wma {
+
+    /**
+     * @brief Copy of a LatencyHistogram; counts are cumulative since the histogram was created or reset
+     */
+    struct LatencySnapshot {
+        std::array<u64, WMA_LATENCY_BUCKETS> counts{};
+        u64 count = 0;
+        u64 sumUs = 0;
+        u64 maxUs = 0;  // Since the last reset, also in since() results
+
+        /**
+         * @brief Events between an earlier snapshot of the same histogram and this one
+         */
+        LatencySnapshot since(const LatencySnapshot& earlier) const {
+            LatencySnapshot delta = *this;
+            for (u32 i = 0; i < WMA_LATENCY_BUCKETS; ++i) {
+                delta.counts[i] -= earlier.counts[i];
+            }
+            delta.count -= earlier.count;
+            delta.sumUs -= earlier.sumUs;
+            return delta;
+        }
+
+        f64 meanMs() const {
+            return count ? static_cast<f64>(sumUs) / static_cast<f64>(count) * 1e-3 : 0.0;
+        }
+
+        f64 maxMs() const { return static_cast<f64>(maxUs) * 1e-3; }
+
+        /**
+         * @brief Upper bound of the bucket holding the nearest-rank percentile, in ms
+         * @param p Percentile in [0, 1]
+         */
+        f64 percentileMs(f64 p) const {
+            if (count == 0) {
+                return 0.0;
+            }
+
+            const f64 clamped = INK_MIN(INK_MAX(p, 0.0), 1.0);
+            const u64 rank = INK_MAX(static_cast<u64>(clamped * static_cast<f64>(count) + 0.999999), static_cast<u64>(1));
+
+            u64 seen = 0;
+            for (u32 i = 0; i < WMA_LATENCY_BUCKETS; ++i) {
+                seen += counts[i];
+                if (seen >= rank) {
+                    return static_cast<f64>(bucketUpperUs(i)) * 1e-3;
+                }
+            }
+            return maxMs();
+        }
+
+        /**
+         * @brief Exclusive upper bound of a bucket in microseconds
+         */
+        static u64 bucketUpperUs(u32 bucket) {
+            constexpr u32 sub = 1u << WMA_LATENCY_SUB_BUCKET_BITS;
+            if (bucket < sub) {
+                return bucket + 1;
+            }
+            const u32 shift = bucket / sub - 1;
+            return (static_cast<u64>(sub + bucket % sub) + 1) << shift;
+        }
+    };
+
+    /**
+     * @brief Allocation-free log-linear histogram of event latencies
+     *
+     * Buckets are powers of two of microseconds, each split into
+     * 2^WMA_LATENCY_SUB_BUCKET_BITS linear steps. One thread records (the
+     * listener's event thread), so counters are bumped with plain relaxed
+     * load/store pairs instead of locked read-modify-writes; any thread may
+     * snapshot at any time and sees every counter whole, though not all
+     * from the same instant. Scrapers keep the previous snapshot and use
+     * LatencySnapshot::since() rather than resetting.
+     */
+    class LatencyHistogram {
+    public:
+        LatencyHistogram() = default;
+
+        LatencyHistogram(const LatencyHistogram& other) {
+            copyFrom(other);
+        }
+
+        LatencyHistogram& operator=(const LatencyHistogram& other) {
+            if (this != &other) {
+                copyFrom(other);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Record how long an event waited; recording thread only
+         * @param timestamp Event time (InputClock ns)
+         * @param now Dispatch time (InputClock ns)
+         */
+        void recordSince(u64 timestamp, u64 now = inputTimeNow()) {
+            record(now > timestamp ? (now - timestamp) / 1000 : 0);
+        }
+
+        /**
+         * @brief Record one latency in microseconds; recording thread only
+         */
+        void record(u64 us) {
+            bump(counts_[bucketOf(us)], 1);
+            bump(count_, 1);
+            bump(sumUs_, us);
+            if (us > maxUs_.load(std::memory_order_relaxed)) {
+                maxUs_.store(us, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @brief Copy every counter; safe from any thread
+         */
+        LatencySnapshot snapshot() const {
+            LatencySnapshot snap;
+            for (u32 i = 0; i < WMA_LATENCY_BUCKETS; ++i) {
+                snap.counts[i] = counts_[i].load(std::memory_order_relaxed);
+            }
+            snap.count = count_.load(std::memory_order_relaxed);
+            snap.sumUs = sumUs_.load(std::memory_order_relaxed);
+            snap.maxUs = maxUs_.load(std::memory_order_relaxed);
+            return snap;
+        }
+
+        /**
+         * @brief Zero every counter; recording thread only
+         */
+        void reset() {
+            for (auto& bucket : counts_) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+            count_.store(0, std::memory_order_relaxed);
+            sumUs_.store(0, std::memory_order_relaxed);
+            maxUs_.store(0, std::memory_order_relaxed);
+        }
+
+        static u32 bucketOf(u64 us) {
+            constexpr u32 subBits = WMA_LATENCY_SUB_BUCKET_BITS;
+            if (us < (1u << subBits)) {
+                return static_cast<u32>(us);
+            }
+            // Octave from the top bit, linear step from the bits below it
+            const u32 top = topBit(us);
+            const u32 step = static_cast<u32>(us >> (top - subBits)) & ((1u << subBits) - 1);
+            const u32 bucket = ((top - subBits + 1) << subBits) + step;
+            return INK_MIN(bucket, static_cast<u32>(WMA_LATENCY_BUCKETS - 1));
+        }
+
+    private:
+        std::array<std::atomic<u64>, WMA_LATENCY_BUCKETS> counts_{};
+        std::atomic<u64> count_{0};
+        std::atomic<u64> sumUs_{0};
+        std::atomic<u64> maxUs_{0};
+
+        static u32 topBit(u64 value) {
+#if defined(__GNUC__) || defined(__clang__)
+            return 63 - static_cast<u32>(__builtin_clzll(value));
+#else
+            u32 top = 0;
+            while (value >>= 1) {
+                ++top;
+            }
+            return top;
+#endif
+        }
+
+        static void bump(std::atomic<u64>& counter, u64 amount) {
+            counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+        }
+
+        void copyFrom(const LatencyHistogram& other) {
+            for (u32 i = 0; i < WMA_LATENCY_BUCKETS; ++i) {
+                counts_[i].store(other.counts_[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+            count_.store(other.count_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            sumUs_.store(other.sumUs_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            maxUs_.store(other.maxUs_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+    };
+
+} // namespace wma
+
+#endif // WMA_CORE_LATENCY_HISTOGRAM_HPP
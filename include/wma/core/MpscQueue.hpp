@@ -0,0 +1,98 @@
+#ifndef WMA_CORE_MPSC_QUEUE_HPP
+#define WMA_CORE_MPSC_QUEUE_HPP
+
+#include <array>
+#include <atomic>
+#include <type_traits>
+#include <ink/ink_base.hpp>
+
+#define WMA_CACHE_LINE_SIZE 64
+
+namespace wma {
+
+    /**
+     * @brief Bounded lock-free multi-producer / single-consumer queue
+     *
+     * Vyukov's bounded queue: every cell carries a sequence number, so producers
+     * claim a slot with one CAS and publish it with one release store, and the
+     * consumer never touches the producers' cache line. No allocation after
+     * construction; push() fails instead of blocking when the queue is full.
+     *
+     * @tparam T Trivially copyable payload
+     * @tparam Capacity Number of slots, a power of two
+     */
+    template <typename T, u32 Capacity>
+    class MpscQueue {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "MpscQueue capacity must be a power of two");
+        static_assert(std::is_trivially_copyable<T>::value, "MpscQueue payload must be trivially copyable");
+
+    public:
+        MpscQueue() {
+            for (u32 i = 0; i < Capacity; ++i) {
+                cells_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        MpscQueue(const MpscQueue&) = delete;
+        MpscQueue& operator=(const MpscQueue&) = delete;
+
+        /**
+         * @brief Enqueue from any thread
+         * @return false if the queue is full
+         */
+        bool push(const T& value) {
+            u64 pos = enqueuePos_.load(std::memory_order_relaxed);
+
+            for (;;) {
+                Cell& cell = cells_[pos & (Capacity - 1)];
+                const u64 sequence = cell.sequence.load(std::memory_order_acquire);
+                const i64 diff = static_cast<i64>(sequence) - static_cast<i64>(pos);
+
+                if (diff == 0) {
+                    if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        cell.value = value;
+                        cell.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if (diff < 0) {
+                    return false; // Full: the consumer has not released this slot yet
+                } else {
+                    pos = enqueuePos_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief Dequeue; only the consumer thread may call this
+         * @return false if the queue is empty
+         */
+        bool pop(T& out) {
+            Cell& cell = cells_[dequeuePos_ & (Capacity - 1)];
+            const u64 sequence = cell.sequence.load(std::memory_order_acquire);
+
+            if (static_cast<i64>(sequence) - static_cast<i64>(dequeuePos_ + 1) < 0) {
+                return false;
+            }
+
+            out = cell.value;
+            cell.sequence.store(dequeuePos_ + Capacity, std::memory_order_release);
+            ++dequeuePos_;
+            return true;
+        }
+
+        static constexpr u32 capacity() { return Capacity; }
+
+    private:
+        struct Cell {
+            std::atomic<u64> sequence;
+            T value;
+        };
+
+        alignas(WMA_CACHE_LINE_SIZE) std::array<Cell, Capacity> cells_;
+        alignas(WMA_CACHE_LINE_SIZE) std::atomic<u64> enqueuePos_{0};
+        alignas(WMA_CACHE_LINE_SIZE) u64 dequeuePos_ = 0;
+    };
+
+} // namespace wma
+
+#endif // WMA_CORE_MPSC_QUEUE_HPP
@@ -0,0 +1,121 @@
+#ifndef WMA_CORE_REACTOR_HPP
+#define WMA_CORE_REACTOR_HPP
+
+#ifdef __linux__
+
+#include <chrono>
+#include <functional>
+#include <unordered_map>
+#include <ink/ink_base.hpp>
+
+#include "Types.hpp"
+
+#define WMA_REACTOR_MAX_EVENTS 32  // epoll events fetched per wait
+
+namespace wma {
+
+    /**
+     * @brief epoll based event loop core (Linux)
+     *
+     * Multiplexes the backend's display connection with user file descriptors,
+     * timerfd timers and an eventfd wakeup, so a frame waits exactly once for
+     * "frame deadline OR input OR user work" instead of sleeping blindly.
+     *
+     * Owned by the X11 and Wayland window managers (see IWindowManager::getReactor).
+     * Everything but wake() must be called from the window thread.
+     */
+    class Reactor {
+    public:
+        using Clock = std::chrono::steady_clock;
+        using FdCallback = std::function<void(u32 events)>;
+        using TimerCallback = std::function<void()>;
+
+        Reactor();
+        ~Reactor();
+
+        // Non-copyable, non-movable (the kernel objects are tied to this instance)
+        Reactor(const Reactor&) = delete;
+        Reactor& operator=(const Reactor&) = delete;
+
+        /**
+         * @brief Register the display connection fd, reported as ReactorDisplay
+         * @param fd Display fd (ConnectionNumber, wl_display_get_fd), -1 to clear
+         */
+        void setDisplayFd(i32 fd);
+
+        /**
+         * @brief Watch a user file descriptor
+         * @param fd Descriptor to watch (not owned)
+         * @param events epoll events (EPOLLIN, EPOLLOUT, ...)
+         * @param callback Called from wait() with the ready events
+         */
+        void addFd(i32 fd, u32 events, FdCallback callback);
+        void modifyFd(i32 fd, u32 events);
+        void removeFd(i32 fd);
+
+        /**
+         * @brief Start a timer on CLOCK_MONOTONIC
+         * @param delayMs First expiration, relative to now
+         * @param intervalMs Period after the first expiration, 0 for a one-shot timer
+         * @param callback Called from wait() on every expiration
+         * @return Timer id for cancelTimer(); ids are never reused, so a stale id cancels nothing
+         */
+        i32 addTimer(f64 delayMs, f64 intervalMs, TimerCallback callback);
+        void cancelTimer(i32 timerId);
+
+        /**
+         * @brief Interrupt a wait in progress (or the next one). Thread-safe.
+         */
+        void wake();
+
+        /**
+         * @brief Wait once until the deadline or until something is ready
+         *
+         * User fd and timer callbacks are dispatched before returning.
+         *
+         * @param deadline Absolute wake-up time, Clock::time_point::max() waits indefinitely
+         * @return ReactorEvent bit mask
+         */
+        u32 wait(Clock::time_point deadline);
+
+        /**
+         * @brief wait() with a relative timeout in ms, -1 waits indefinitely
+         */
+        u32 wait(i32 timeoutMs);
+
+        i32 getEpollFd() const { return epollFd_; }
+
+        /**
+         * @brief Absolute deadline for a relative timeout in ms (-1 gives time_point::max())
+         */
+        static Clock::time_point deadlineFromTimeout(i32 timeoutMs);
+
+    private:
+        struct Watch {
+            FdCallback fdCallback;
+            TimerCallback timerCallback;
+            u32 serial = 0;  // Unique per watch, carried in the epoll data next to the fd
+            bool timer = false;
+            bool periodic = false;
+        };
+
+        i32 epollFd_;
+        i32 wakeFd_;      // eventfd
+        i32 deadlineFd_;  // timerfd, armed per wait with the absolute deadline
+        i32 displayFd_;
+        std::unordered_map<i32, Watch> watches_;     // By fd
+        std::unordered_map<i32, i32> timerFds_;      // Timer id (its watch serial) -> timerfd
+        u32 nextSerial_ = 1;                         // 0 tags the reactor's own fds
+
+        void control(i32 op, i32 fd, u32 events, u32 serial = 0);
+        void armDeadline(Clock::time_point deadline);
+        void dispatch(i32 fd, u32 serial, u32 events);
+        void closeTimer(i32 fd);
+        void release();
+    };
+
+} // namespace wma
+
+#endif // __linux__
+
+#endif // WMA_CORE_REACTOR_HPP
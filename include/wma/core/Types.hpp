@@ -19,6 +19,37 @@ namespace wma {
         WAYLAND
     };
 
+    // Frame pacing strategy used by FrameTimer
+    enum FramePacing : i32 {
+        FixedSpin,    // Sleep, then busy-wait a fixed LIMIT_SPIN_LOOP_DURATION window
+        AdaptiveSpin, // Busy-wait window sized from the measured sleep overshoot
+        Deadline      // Absolute CLOCK_MONOTONIC timeline, no drift across frames
+    };
+
+    // How Deadline pacing re-synchronises after a frame overruns its slot
+    enum FrameOverrun : i32 {
+        SkipMissed, // Drop the missed slots and wait for the next one on the timeline
+        CatchUp     // Run late frames back-to-back until the timeline is met again
+    };
+
+    // Phases of one frame, timed separately by FrameTimer
+    enum FramePhase : i32 {
+        PhaseEvents,   // Event pump (processEvents / glfwPollEvents)
+        PhaseActions,  // User process() callback
+        PhasePresent,  // Clear + buffer swap
+        PhaseSleep,    // Frame pacing wait
+        PhaseCount
+    };
+
+    // Why Reactor::wait returned (bit mask)
+    enum ReactorEvent : u32 {
+        ReactorNone = 0,
+        ReactorDisplay = 1u << 0,    // Display connection is readable
+        ReactorWakeup = 1u << 1,     // Reactor::wake() was called
+        ReactorTimeout = 1u << 2,    // The deadline passed
+        ReactorDispatched = 1u << 3  // User fd or timer callbacks ran
+    };
+
     enum WmaCode : i32 {
         OK,
         ERROR
@@ -26,16 +57,16 @@ namespace wma {
 
 #ifdef WMA_ENABLE_GLFW
     class GlfwWindowManager;
-    class KeyboardListener;
-    class MouseListener;
+    class GLFWKeyboardListener;
+    class GLFWMouseListener;
 
     /**
-     * @brief User data structure for GLFW callbacks
+     * @brief User data structure for GLFW callbacks (concrete types, no casts per event)
      */
     struct GlfwUserData {
         GlfwWindowManager* windowManager = nullptr;
-        KeyboardListener* keyboardListener = nullptr;
-        MouseListener* mouseListener = nullptr;
+        GLFWKeyboardListener* keyboardListener = nullptr;
+        GLFWMouseListener* mouseListener = nullptr;
     };
 #endif
 
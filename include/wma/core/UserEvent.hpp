@@ -0,0 +1,31 @@
+#ifndef WMA_CORE_USER_EVENT_HPP
+#define WMA_CORE_USER_EVENT_HPP
+
+#include <functional>
+#include <ink/ink_base.hpp>
+
+#include "MpscQueue.hpp"
+
+#define WMA_USER_EVENT_CAPACITY 256  // pending posted events per window (power of two)
+
+namespace wma {
+
+    /**
+     * @brief Small payload posted to the window loop from any thread
+     */
+    struct UserEvent {
+        u32 type = 0;            // Application defined
+        u64 value = 0;
+        void* pointer = nullptr; // Ownership is up to the application
+
+        UserEvent() = default;
+        UserEvent(u32 type_, u64 value_ = 0, void* pointer_ = nullptr)
+            : type(type_), value(value_), pointer(pointer_) {}
+    };
+
+    using UserEventQueue = MpscQueue<UserEvent, WMA_USER_EVENT_CAPACITY>;
+    using UserEventCallback = std::function<void(const UserEvent&)>;
+
+} // namespace wma
+
+#endif // WMA_CORE_USER_EVENT_HPP
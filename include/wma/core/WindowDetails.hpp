@@ -3,6 +3,8 @@
 
 #include <ink/ink_base.hpp>
 
+#include "Types.hpp"
+
 namespace wma {
 
     /**
@@ -15,6 +17,11 @@ namespace wma {
         i32 targetFPS = 60;
         bool vsync = false;
         bool fullscreen = false;
+        FramePacing framePacing = FramePacing::AdaptiveSpin;
+        FrameOverrun frameOverrun = FrameOverrun::SkipMissed;
+        u64 timerSlackNs = 0; // 0 keeps the thread's default timer slack
+        bool idleWhenInactive = false; // Block on input while minimized or unfocused
+        i32 backgroundFPS = 0;         // Frame rate while idle, 0 renders only on events / requestRedraw()
         
         // Default constructor
         WindowDetails() = default;
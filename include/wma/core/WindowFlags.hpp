@@ -3,6 +3,8 @@
 
 #include <ink/ink_base.hpp>
 
+#include "FrameStats.hpp"
+
 namespace wma {
 
     /**
@@ -12,11 +14,13 @@ namespace wma {
         bool resized;
         bool minimized ;
         bool focused;
+        bool idle; // Set by the application to block on input until an event or requestRedraw()
         f64 deltaTime;
         f64 fps;
+        FrameStats frameStats; // Rolling frame-time window (p50/p95/p99, over-budget counters)
 
         WindowFlags() :
-            resized(false), minimized(false), focused(true), deltaTime(0), fps(0.0) {}
+            resized(false), minimized(false), focused(true), idle(false), deltaTime(0), fps(0.0) {}
     };
 
 } // namespace wma
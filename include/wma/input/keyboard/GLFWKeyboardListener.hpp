@@ -11,7 +11,7 @@ namespace wma {
 /**
  * @brief GLFW-specific keyboard listener implementation
  */
-class GLFWKeyboardListener : public KeyboardListener {
+class GLFWKeyboardListener final : public KeyboardListener {
 public:
     GLFWKeyboardListener();
     ~GLFWKeyboardListener() override;
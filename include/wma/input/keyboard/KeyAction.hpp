@@ -1,19 +1,82 @@
 #ifndef WMA_INPUT_KEY_ACTION_HPP
 #define WMA_INPUT_KEY_ACTION_HPP
 
-#include <functional>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <ink/ink_base.hpp>
+
+#include "wma/core/InplaceFunction.hpp"
 
 namespace wma {
 
     /**
-     * @brief Encapsulates key press and release actions
+     * @brief Key event passed to event callbacks
+     */
+    struct WMAKeyEvent {
+        i32 key = -1;       // Unified key code
+        u64 timestamp = 0;  // When the device produced it, InputClock nanoseconds (see InputClock.hpp)
+        bool repeat = false;
+
+        WMAKeyEvent() = default;
+        WMAKeyEvent(i32 key, u64 timestamp, bool repeat = false)
+            : key(key), timestamp(timestamp), repeat(repeat) {}
+    };
+
+    namespace detail {
+
+        // Accepted by KeyAction: nullptr, or callable with () or (const WMAKeyEvent&)
+        template <typename F>
+        constexpr bool isKeyCallback() {
+            using D = std::decay_t<F>;
+            return std::is_same<D, std::nullptr_t>::value || std::is_invocable<D&, const WMAKeyEvent&>::value ||
+                   std::is_invocable<D&>::value;
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Encapsulates key press, release and auto repeat actions
+     *
+     * Auto repeats of a held key run onRepeat only, on every backend, so a
+     * press action fires once per physical press.
+     *
+     * Each callback takes either no argument or the WMAKeyEvent, with the
+     * device timestamp of the key event; the two forms can be mixed. Both
+     * are stored as an EventCallback, so an action is three inline
+     * callables (96 bytes by default) whatever the form. A callable that
+     * does not fit WMA_CALLBACK_CAPACITY, such as a std::function, binds
+     * through the context pointer constructor.
      */
     class KeyAction {
     public:
-        using ActionCallback = std::function<void()>;
-        
-        KeyAction(ActionCallback onPress = nullptr, ActionCallback onRelease = nullptr)
-            : onPress_(std::move(onPress)), onRelease_(std::move(onRelease)) {}
+        using EventCallback = InplaceFunction<void(const WMAKeyEvent&)>;  // Inline, never allocates
+        using ContextCallback = void (*)(void* context, const WMAKeyEvent& event);
+
+        KeyAction() = default;
+
+        /**
+         * @param onPress, onRelease, onRepeat Callables taking () or (const WMAKeyEvent&), or nullptr
+         */
+        template <typename Press, typename Release = std::nullptr_t, typename Repeat = std::nullptr_t,
+                  typename = std::enable_if_t<detail::isKeyCallback<Press>() && detail::isKeyCallback<Release>() &&
+                                              detail::isKeyCallback<Repeat>()>>
+        KeyAction(Press&& onPress, Release&& onRelease = nullptr, Repeat&& onRepeat = nullptr)
+            : callbacks_{wrap(std::forward<Press>(onPress)), wrap(std::forward<Release>(onRelease)),
+                         wrap(std::forward<Repeat>(onRepeat))} {}
+
+        /**
+         * @brief Plain function pointers sharing one context, e.g. a std::function or an object outliving the binding
+         *
+         * @code
+         * std::function<void()> onEscape = ...;
+         * KeyAction action(&onEscape, [](void* f, const WMAKeyEvent&) { (*static_cast<std::function<void()>*>(f))(); });
+         * @endcode
+         */
+        KeyAction(void* context, ContextCallback onPress, ContextCallback onRelease = nullptr,
+                  ContextCallback onRepeat = nullptr)
+            : callbacks_{bind(context, onPress), bind(context, onRelease), bind(context, onRepeat)} {}
         
         // Copy constructor
         KeyAction(const KeyAction& other) = default;
@@ -30,38 +93,86 @@ namespace wma {
         /**
          * @brief Execute the press action if available
          */
-        void executePress() const {
-            if (onPress_) {
-                onPress_();
-            }
+        void executePress(const WMAKeyEvent& event) const {
+            execute(WMAPress, event);
         }
         
         /**
          * @brief Execute the release action if available
          */
-        void executeRelease() const {
-            if (onRelease_) {
-                onRelease_();
-            }
+        void executeRelease(const WMAKeyEvent& event) const {
+            execute(WMARelease, event);
+        }
+        
+        /**
+         * @brief Execute the repeat action if available
+         */
+        void executeRepeat(const WMAKeyEvent& event) const {
+            execute(WMARepeat, event);
         }
         
         /**
          * @brief Check if press action is available
          */
         bool hasPressAction() const {
-            return static_cast<bool>(onPress_);
+            return static_cast<bool>(callbacks_[WMAPress]);
         }
         
         /**
          * @brief Check if release action is available
          */
         bool hasReleaseAction() const {
-            return static_cast<bool>(onRelease_);
+            return static_cast<bool>(callbacks_[WMARelease]);
+        }
+        
+        /**
+         * @brief Check if repeat action is available
+         */
+        bool hasRepeatAction() const {
+            return static_cast<bool>(callbacks_[WMARepeat]);
         }
         
     private:
-        ActionCallback onPress_;
-        ActionCallback onRelease_;
+        enum WMASlot : u32 { WMAPress, WMARelease, WMARepeat };
+
+        // Runs an argument-less callable from an EventCallback; same size as the callable itself
+        template <typename F>
+        struct IgnoreEvent {
+            F callback;
+            void operator()(const WMAKeyEvent&) { callback(); }
+        };
+
+        template <typename F>
+        static EventCallback wrap(F&& callback) {
+            using D = std::decay_t<F>;
+            if constexpr (std::is_same<D, std::nullptr_t>::value) {
+                return nullptr;
+            } else if constexpr (std::is_invocable<D&, const WMAKeyEvent&>::value) {
+                return EventCallback(std::forward<F>(callback));
+            } else {
+                if constexpr (std::is_pointer<D>::value) {
+                    if (callback == nullptr) {
+                        return nullptr;
+                    }
+                }
+                return EventCallback(IgnoreEvent<D>{std::forward<F>(callback)});
+            }
+        }
+
+        static EventCallback bind(void* context, ContextCallback callback) {
+            if (callback == nullptr) {
+                return nullptr;
+            }
+            return EventCallback([context, callback](const WMAKeyEvent& event) { callback(context, event); });
+        }
+
+        void execute(WMASlot slot, const WMAKeyEvent& event) const {
+            if (callbacks_[slot]) {
+                callbacks_[slot](event);
+            }
+        }
+
+        std::array<EventCallback, 3> callbacks_;
     };
 
 } // namespace wma
@@ -1,9 +1,14 @@
 #ifndef WMA_INPUT_KEYBOARD_LISTENER_HPP
 #define WMA_INPUT_KEYBOARD_LISTENER_HPP
 
-#include <unordered_map>
+#include <algorithm>
+#include <array>
+#include <bitset>
 
-#include "wma/input/KeyAction.hpp"
+#include "wma/input/keyboard/KeyAction.hpp"
+#include "wma/input/keyboard/Keys.h"
+#include "wma/core/InputClock.hpp"
+#include "wma/core/LatencyHistogram.hpp"
 #include "wma/core/Types.hpp"
 
 namespace wma {
@@ -31,6 +36,7 @@ public:
      * @brief Add a key action mapping
      * @param key The key code (unified key enum)
      * @param action The action to execute
+     * @throws InputException if key is outside [0, KEY_COUNT)
      */
     void addKeyAction(i32 key, KeyAction action);
 
@@ -52,8 +58,135 @@ public:
      */
     bool hasKeyAction(i32 key) const;
 
+    /**
+     * @brief Check if a key is currently held down
+     * @param key The key code to check (KEY_UNKNOWN and out of range keys read as up)
+     */
+    bool isKeyDown(i32 key) const { return keysDown_[stateIndex(key)]; }
+
+    /**
+     * @brief Check if a key went down since the last frame rollover
+     */
+    bool keyPressedThisFrame(i32 key) const { return keysPressed_[stateIndex(key)]; }
+
+    /**
+     * @brief Check if a key went up since the last frame rollover
+     *
+     * A tap shorter than a frame reports both pressed and released.
+     */
+    bool keyReleasedThisFrame(i32 key) const { return keysReleased_[stateIndex(key)]; }
+
+    /**
+     * @brief Check if a held key auto repeated since the last frame rollover
+     */
+    bool keyRepeatedThisFrame(i32 key) const { return keysRepeated_[stateIndex(key)]; }
+
+    /**
+     * @brief Device timestamp of the key event being dispatched (InputClock ns)
+     *
+     * Valid inside key callbacks, including the argument-less ones; the
+     * GLFW backend has no device times and reports the arrival time.
+     */
+    u64 getEventTime() const { return eventTime_; }
+
+    /**
+     * @brief How long key events waited between their device timestamp and dispatch
+     *
+     * Covers presses, releases and repeats. Snapshot it from any thread.
+     */
+    const LatencyHistogram& getKeyLatency() const { return keyLatency_; }
+
+    /**
+     * @brief Clear the per-frame edges; called by the window manager's endFrame()
+     */
+    void newFrame() {
+        keysPressed_.reset();
+        keysReleased_.reset();
+        keysRepeated_.reset();
+    }
+
+    /**
+     * @brief Release every held key (focus loss), reported as released this frame
+     */
+    void releaseAllKeys() {
+        keysReleased_ |= keysDown_;
+        keysDown_.reset();
+    }
+
 protected:
-    std::unordered_map<i32, KeyAction> keyActions_;
+    /**
+     * @brief Record a press/release from the backend; repeats of a held key are not edges
+     */
+    void setKeyState(i32 key, bool down);
+
+    /**
+     * @brief Shared press path of the backends
+     * @param key Mapped key
+     * @param timestamp Event time on InputClock (ns)
+     * @param repeat true for an auto repeat of a held key: runs onRepeat and leaves the edges alone
+     */
+    void dispatchKeyPress(i32 key, u64 timestamp, bool repeat = false) {
+        const KeyAction* action = findKeyAction(key);
+        eventTime_ = timestamp;
+        keyLatency_.recordSince(timestamp);
+
+        if (repeat) {
+            const size_t index = stateIndex(key);
+            if (index != KEY_COUNT) {
+                keysRepeated_.set(index);
+            }
+            if (action) {
+                action->executeRepeat(WMAKeyEvent(key, timestamp, true));
+            }
+            return;
+        }
+
+        setKeyState(key, true);
+        if (action) {
+            action->executePress(WMAKeyEvent(key, timestamp));
+        }
+    }
+
+    /**
+     * @brief Shared release path of the backends
+     */
+    void dispatchKeyRelease(i32 key, u64 timestamp) {
+        eventTime_ = timestamp;
+        keyLatency_.recordSince(timestamp);
+        setKeyState(key, false);
+        if (const KeyAction* action = findKeyAction(key)) {
+            action->executeRelease(WMAKeyEvent(key, timestamp));
+        }
+    }
+
+    // Clamps out of range keys onto the extra, always clear bit so queries need no branch
+    static size_t stateIndex(i32 key) {
+        return std::min(static_cast<u32>(key), static_cast<u32>(KEY_COUNT));
+    }
+
+    /**
+     * @brief Bound action for a key, nullptr if none (hot path for the backends)
+     */
+    const KeyAction* findKeyAction(i32 key) const {
+        if (static_cast<u32>(key) >= static_cast<u32>(KEY_COUNT) || !boundKeys_.test(key)) {
+            return nullptr;
+        }
+        return &keyActions_[key];
+    }
+
+    // Indexed by Key: one bounds check and one bit test per event, no hashing
+    std::array<KeyAction, KEY_COUNT> keyActions_;
+    std::bitset<KEY_COUNT> boundKeys_;
+
+    // Polled state, one spare bit at KEY_COUNT (see stateIndex)
+    std::bitset<KEY_COUNT + 1> keysDown_;
+    std::bitset<KEY_COUNT + 1> keysPressed_;
+    std::bitset<KEY_COUNT + 1> keysReleased_;
+    std::bitset<KEY_COUNT + 1> keysRepeated_;
+
+    u64 eventTime_ = 0;
+    InputClockMapper deviceClock_;  // Millisecond, 32-bit event times of X11, Wayland and SDL
+    LatencyHistogram keyLatency_;
 };
 
 } // namespace wma
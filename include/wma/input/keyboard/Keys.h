@@ -1,6 +1,8 @@
 #ifndef KEYS_H
 #define KEYS_H
 
+#include <array>
+#include <cstddef>
 #include <ink/ink_base.hpp>
 
 #ifdef WMA_ENABLE_GLFW
@@ -14,6 +16,10 @@
 #ifdef WMA_ENABLE_X11
 #include <X11/Xlib.h>
 #include <X11/keysym.h>
+#define WMA_KEYSYM(name) XK_##name
+#elif defined(WMA_ENABLE_WAYLAND)
+#include <xkbcommon/xkbcommon-keysyms.h>
+#define WMA_KEYSYM(name) XKB_KEY_##name  // Same values as the X11 XK_* keysyms
 #endif
 
 namespace wma {
@@ -134,382 +140,596 @@ enum Key : i32 {
     KEY_KP_ADD,
     KEY_KP_ENTER,
 
+    KEY_COUNT,  // Number of keys, size of per-key tables
+
     KEY_UNKNOWN = -1
 };
 
+namespace detail {
+
+// Backend code -> Key pair; the translation tables below are generated from these lists at compile time
+struct KeyMapping {
+    i64 code;
+    Key key;
+};
+
+// Dense translation table: one byte per backend code, KEY_UNKNOWN (-1) where nothing is mapped
+template <size_t Size>
+using KeyTable = std::array<i8, Size>;
+
+static_assert(KEY_COUNT <= 127, "Key must fit the i8 translation tables");
+
+// Table covering the codes [base, base + Size); mappings outside that range belong to another table
+template <size_t Size, size_t N>
+constexpr KeyTable<Size> makeKeyTable(const KeyMapping (&mappings)[N], i64 base) {
+    KeyTable<Size> table{};
+    for (size_t i = 0; i < Size; ++i) {
+        table[i] = static_cast<i8>(KEY_UNKNOWN);
+    }
+    for (size_t i = 0; i < N; ++i) {
+        const i64 index = mappings[i].code - base;
+        if (index >= 0 && index < static_cast<i64>(Size)) {
+            table[static_cast<size_t>(index)] = static_cast<i8>(mappings[i].key);
+        }
+    }
+    return table;
+}
+
+// One compare and one load per translation
+template <size_t Size>
+constexpr Key lookupKey(const KeyTable<Size>& table, u64 index) {
+    return index < Size ? static_cast<Key>(table[index]) : KEY_UNKNOWN;
+}
+
+} // namespace detail
+
 #ifdef WMA_ENABLE_GLFW
 
-//! Map keys to GLFW
-inline Key mapGLFWKey(int glfwKey) {
-    switch (glfwKey) {
+namespace detail {
+
+inline constexpr KeyMapping glfwKeyMappings[] = {
     // Letters
-    case GLFW_KEY_A: return Key::KEY_A;
-    case GLFW_KEY_B: return Key::KEY_B;
-    case GLFW_KEY_C: return Key::KEY_C;
-    case GLFW_KEY_D: return Key::KEY_D;
-    case GLFW_KEY_E: return Key::KEY_E;
-    case GLFW_KEY_F: return Key::KEY_F;
-    case GLFW_KEY_G: return Key::KEY_G;
-    case GLFW_KEY_H: return Key::KEY_H;
-    case GLFW_KEY_I: return Key::KEY_I;
-    case GLFW_KEY_J: return Key::KEY_J;
-    case GLFW_KEY_K: return Key::KEY_K;
-    case GLFW_KEY_L: return Key::KEY_L;
-    case GLFW_KEY_M: return Key::KEY_M;
-    case GLFW_KEY_N: return Key::KEY_N;
-    case GLFW_KEY_O: return Key::KEY_O;
-    case GLFW_KEY_P: return Key::KEY_P;
-    case GLFW_KEY_Q: return Key::KEY_Q;
-    case GLFW_KEY_R: return Key::KEY_R;
-    case GLFW_KEY_S: return Key::KEY_S;
-    case GLFW_KEY_T: return Key::KEY_T;
-    case GLFW_KEY_U: return Key::KEY_U;
-    case GLFW_KEY_V: return Key::KEY_V;
-    case GLFW_KEY_W: return Key::KEY_W;
-    case GLFW_KEY_X: return Key::KEY_X;
-    case GLFW_KEY_Y: return Key::KEY_Y;
-    case GLFW_KEY_Z: return Key::KEY_Z;
-
-        // Numbers
-    case GLFW_KEY_0: return Key::KEY_0;
-    case GLFW_KEY_1: return Key::KEY_1;
-    case GLFW_KEY_2: return Key::KEY_2;
-    case GLFW_KEY_3: return Key::KEY_3;
-    case GLFW_KEY_4: return Key::KEY_4;
-    case GLFW_KEY_5: return Key::KEY_5;
-    case GLFW_KEY_6: return Key::KEY_6;
-    case GLFW_KEY_7: return Key::KEY_7;
-    case GLFW_KEY_8: return Key::KEY_8;
-    case GLFW_KEY_9: return Key::KEY_9;
-
-        // Function keys
-    case GLFW_KEY_F1: return Key::KEY_F1;
-    case GLFW_KEY_F2: return Key::KEY_F2;
-    case GLFW_KEY_F3: return Key::KEY_F3;
-    case GLFW_KEY_F4: return Key::KEY_F4;
-    case GLFW_KEY_F5: return Key::KEY_F5;
-    case GLFW_KEY_F6: return Key::KEY_F6;
-    case GLFW_KEY_F7: return Key::KEY_F7;
-    case GLFW_KEY_F8: return Key::KEY_F8;
-    case GLFW_KEY_F9: return Key::KEY_F9;
-    case GLFW_KEY_F10: return Key::KEY_F10;
-    case GLFW_KEY_F11: return Key::KEY_F11;
-    case GLFW_KEY_F12: return Key::KEY_F12;
-
-        // Controls
-    case GLFW_KEY_ESCAPE: return Key::KEY_ESCAPE;
-    case GLFW_KEY_ENTER: return Key::KEY_ENTER;
-    case GLFW_KEY_TAB: return Key::KEY_TAB;
-    case GLFW_KEY_BACKSPACE: return Key::KEY_BACKSPACE;
-    case GLFW_KEY_INSERT: return Key::KEY_INSERT;
-    case GLFW_KEY_DELETE: return Key::KEY_DELETE;
-    case GLFW_KEY_RIGHT: return Key::KEY_RIGHT;
-    case GLFW_KEY_LEFT: return Key::KEY_LEFT;
-    case GLFW_KEY_DOWN: return Key::KEY_DOWN;
-    case GLFW_KEY_UP: return Key::KEY_UP;
-    case GLFW_KEY_PAGE_UP: return Key::KEY_PAGE_UP;
-    case GLFW_KEY_PAGE_DOWN: return Key::KEY_PAGE_DOWN;
-    case GLFW_KEY_HOME: return Key::KEY_HOME;
-    case GLFW_KEY_END: return Key::KEY_END;
-
-        // Modifiers
-    case GLFW_KEY_LEFT_SHIFT: return Key::KEY_LEFT_SHIFT;
-    case GLFW_KEY_RIGHT_SHIFT: return Key::KEY_RIGHT_SHIFT;
-    case GLFW_KEY_LEFT_CONTROL: return Key::KEY_LEFT_CTRL;
-    case GLFW_KEY_RIGHT_CONTROL: return Key::KEY_RIGHT_CTRL;
-    case GLFW_KEY_LEFT_ALT: return Key::KEY_LEFT_ALT;
-    case GLFW_KEY_RIGHT_ALT: return Key::KEY_RIGHT_ALT;
-    case GLFW_KEY_LEFT_SUPER: return Key::KEY_LEFT_SUPER;
-    case GLFW_KEY_RIGHT_SUPER: return Key::KEY_RIGHT_SUPER;
-    case GLFW_KEY_CAPS_LOCK: return Key::KEY_CAPS_LOCK;
-    case GLFW_KEY_SCROLL_LOCK: return Key::KEY_SCROLL_LOCK;
-    case GLFW_KEY_NUM_LOCK: return Key::KEY_NUM_LOCK;
-
-        // Symbols
-    case GLFW_KEY_SPACE: return Key::KEY_SPACE;
-    case GLFW_KEY_MINUS: return Key::KEY_MINUS;
-    case GLFW_KEY_EQUAL: return Key::KEY_EQUAL;
-    case GLFW_KEY_LEFT_BRACKET: return Key::KEY_LEFT_BRACKET;
-    case GLFW_KEY_RIGHT_BRACKET: return Key::KEY_RIGHT_BRACKET;
-    case GLFW_KEY_BACKSLASH: return Key::KEY_BACKSLASH;
-    case GLFW_KEY_SEMICOLON: return Key::KEY_SEMICOLON;
-    case GLFW_KEY_APOSTROPHE: return Key::KEY_APOSTROPHE;
-    case GLFW_KEY_GRAVE_ACCENT: return Key::KEY_GRAVE;
-    case GLFW_KEY_COMMA: return Key::KEY_COMMA;
-    case GLFW_KEY_PERIOD: return Key::KEY_PERIOD;
-    case GLFW_KEY_SLASH: return Key::KEY_SLASH;
+    {GLFW_KEY_A, KEY_A},
+    {GLFW_KEY_B, KEY_B},
+    {GLFW_KEY_C, KEY_C},
+    {GLFW_KEY_D, KEY_D},
+    {GLFW_KEY_E, KEY_E},
+    {GLFW_KEY_F, KEY_F},
+    {GLFW_KEY_G, KEY_G},
+    {GLFW_KEY_H, KEY_H},
+    {GLFW_KEY_I, KEY_I},
+    {GLFW_KEY_J, KEY_J},
+    {GLFW_KEY_K, KEY_K},
+    {GLFW_KEY_L, KEY_L},
+    {GLFW_KEY_M, KEY_M},
+    {GLFW_KEY_N, KEY_N},
+    {GLFW_KEY_O, KEY_O},
+    {GLFW_KEY_P, KEY_P},
+    {GLFW_KEY_Q, KEY_Q},
+    {GLFW_KEY_R, KEY_R},
+    {GLFW_KEY_S, KEY_S},
+    {GLFW_KEY_T, KEY_T},
+    {GLFW_KEY_U, KEY_U},
+    {GLFW_KEY_V, KEY_V},
+    {GLFW_KEY_W, KEY_W},
+    {GLFW_KEY_X, KEY_X},
+    {GLFW_KEY_Y, KEY_Y},
+    {GLFW_KEY_Z, KEY_Z},
+
+    // Numbers
+    {GLFW_KEY_0, KEY_0},
+    {GLFW_KEY_1, KEY_1},
+    {GLFW_KEY_2, KEY_2},
+    {GLFW_KEY_3, KEY_3},
+    {GLFW_KEY_4, KEY_4},
+    {GLFW_KEY_5, KEY_5},
+    {GLFW_KEY_6, KEY_6},
+    {GLFW_KEY_7, KEY_7},
+    {GLFW_KEY_8, KEY_8},
+    {GLFW_KEY_9, KEY_9},
+
+    // Function keys
+    {GLFW_KEY_F1, KEY_F1},
+    {GLFW_KEY_F2, KEY_F2},
+    {GLFW_KEY_F3, KEY_F3},
+    {GLFW_KEY_F4, KEY_F4},
+    {GLFW_KEY_F5, KEY_F5},
+    {GLFW_KEY_F6, KEY_F6},
+    {GLFW_KEY_F7, KEY_F7},
+    {GLFW_KEY_F8, KEY_F8},
+    {GLFW_KEY_F9, KEY_F9},
+    {GLFW_KEY_F10, KEY_F10},
+    {GLFW_KEY_F11, KEY_F11},
+    {GLFW_KEY_F12, KEY_F12},
+
+    // Controls
+    {GLFW_KEY_ESCAPE, KEY_ESCAPE},
+    {GLFW_KEY_ENTER, KEY_ENTER},
+    {GLFW_KEY_TAB, KEY_TAB},
+    {GLFW_KEY_BACKSPACE, KEY_BACKSPACE},
+    {GLFW_KEY_INSERT, KEY_INSERT},
+    {GLFW_KEY_DELETE, KEY_DELETE},
+    {GLFW_KEY_RIGHT, KEY_RIGHT},
+    {GLFW_KEY_LEFT, KEY_LEFT},
+    {GLFW_KEY_DOWN, KEY_DOWN},
+    {GLFW_KEY_UP, KEY_UP},
+    {GLFW_KEY_PAGE_UP, KEY_PAGE_UP},
+    {GLFW_KEY_PAGE_DOWN, KEY_PAGE_DOWN},
+    {GLFW_KEY_HOME, KEY_HOME},
+    {GLFW_KEY_END, KEY_END},
+
+    // Modifiers
+    {GLFW_KEY_LEFT_SHIFT, KEY_LEFT_SHIFT},
+    {GLFW_KEY_RIGHT_SHIFT, KEY_RIGHT_SHIFT},
+    {GLFW_KEY_LEFT_CONTROL, KEY_LEFT_CTRL},
+    {GLFW_KEY_RIGHT_CONTROL, KEY_RIGHT_CTRL},
+    {GLFW_KEY_LEFT_ALT, KEY_LEFT_ALT},
+    {GLFW_KEY_RIGHT_ALT, KEY_RIGHT_ALT},
+    {GLFW_KEY_LEFT_SUPER, KEY_LEFT_SUPER},
+    {GLFW_KEY_RIGHT_SUPER, KEY_RIGHT_SUPER},
+    {GLFW_KEY_CAPS_LOCK, KEY_CAPS_LOCK},
+    {GLFW_KEY_SCROLL_LOCK, KEY_SCROLL_LOCK},
+    {GLFW_KEY_NUM_LOCK, KEY_NUM_LOCK},
+
+    // Symbols
+    {GLFW_KEY_SPACE, KEY_SPACE},
+    {GLFW_KEY_MINUS, KEY_MINUS},
+    {GLFW_KEY_EQUAL, KEY_EQUAL},
+    {GLFW_KEY_LEFT_BRACKET, KEY_LEFT_BRACKET},
+    {GLFW_KEY_RIGHT_BRACKET, KEY_RIGHT_BRACKET},
+    {GLFW_KEY_BACKSLASH, KEY_BACKSLASH},
+    {GLFW_KEY_SEMICOLON, KEY_SEMICOLON},
+    {GLFW_KEY_APOSTROPHE, KEY_APOSTROPHE},
+    {GLFW_KEY_GRAVE_ACCENT, KEY_GRAVE},
+    {GLFW_KEY_COMMA, KEY_COMMA},
+    {GLFW_KEY_PERIOD, KEY_PERIOD},
+    {GLFW_KEY_SLASH, KEY_SLASH},
 
     // Keypad
-    case GLFW_KEY_KP_0: return Key::KEY_KP_0;
-    case GLFW_KEY_KP_1: return Key::KEY_KP_1;
-    case GLFW_KEY_KP_2: return Key::KEY_KP_2;
-    case GLFW_KEY_KP_3: return Key::KEY_KP_3;
-    case GLFW_KEY_KP_4: return Key::KEY_KP_4;
-    case GLFW_KEY_KP_5: return Key::KEY_KP_5;
-    case GLFW_KEY_KP_6: return Key::KEY_KP_6;
-    case GLFW_KEY_KP_7: return Key::KEY_KP_7;
-    case GLFW_KEY_KP_8: return Key::KEY_KP_8;
-    case GLFW_KEY_KP_9: return Key::KEY_KP_9;
-    case GLFW_KEY_KP_DECIMAL: return Key::KEY_KP_DECIMAL;
-    case GLFW_KEY_KP_DIVIDE: return Key::KEY_KP_DIVIDE;
-    case GLFW_KEY_KP_MULTIPLY: return Key::KEY_KP_MULTIPLY;
-    case GLFW_KEY_KP_SUBTRACT: return Key::KEY_KP_SUBTRACT;
-    case GLFW_KEY_KP_ADD: return Key::KEY_KP_ADD;
-    case GLFW_KEY_KP_ENTER: return Key::KEY_KP_ENTER;
-
-    default: return Key::KEY_UNKNOWN;
-    }
+    {GLFW_KEY_KP_0, KEY_KP_0},
+    {GLFW_KEY_KP_1, KEY_KP_1},
+    {GLFW_KEY_KP_2, KEY_KP_2},
+    {GLFW_KEY_KP_3, KEY_KP_3},
+    {GLFW_KEY_KP_4, KEY_KP_4},
+    {GLFW_KEY_KP_5, KEY_KP_5},
+    {GLFW_KEY_KP_6, KEY_KP_6},
+    {GLFW_KEY_KP_7, KEY_KP_7},
+    {GLFW_KEY_KP_8, KEY_KP_8},
+    {GLFW_KEY_KP_9, KEY_KP_9},
+    {GLFW_KEY_KP_DECIMAL, KEY_KP_DECIMAL},
+    {GLFW_KEY_KP_DIVIDE, KEY_KP_DIVIDE},
+    {GLFW_KEY_KP_MULTIPLY, KEY_KP_MULTIPLY},
+    {GLFW_KEY_KP_SUBTRACT, KEY_KP_SUBTRACT},
+    {GLFW_KEY_KP_ADD, KEY_KP_ADD},
+    {GLFW_KEY_KP_ENTER, KEY_KP_ENTER},
+};
+
+// GLFW key codes are dense in [0, GLFW_KEY_LAST]
+inline constexpr auto glfwKeyTable = makeKeyTable<GLFW_KEY_LAST + 1>(glfwKeyMappings, 0);
+
+} // namespace detail
+
+//! Map keys to GLFW
+inline Key mapGLFWKey(int glfwKey) {
+    return detail::lookupKey(detail::glfwKeyTable, static_cast<u32>(glfwKey));
 }
 
 #endif
 
 
 #ifdef WMA_ENABLE_SDL
+
+namespace detail {
+
+inline constexpr KeyMapping sdlKeyMappings[] = {
+    // Letters
+    {SDLK_a, KEY_A},
+    {SDLK_b, KEY_B},
+    {SDLK_c, KEY_C},
+    {SDLK_d, KEY_D},
+    {SDLK_e, KEY_E},
+    {SDLK_f, KEY_F},
+    {SDLK_g, KEY_G},
+    {SDLK_h, KEY_H},
+    {SDLK_i, KEY_I},
+    {SDLK_j, KEY_J},
+    {SDLK_k, KEY_K},
+    {SDLK_l, KEY_L},
+    {SDLK_m, KEY_M},
+    {SDLK_n, KEY_N},
+    {SDLK_o, KEY_O},
+    {SDLK_p, KEY_P},
+    {SDLK_q, KEY_Q},
+    {SDLK_r, KEY_R},
+    {SDLK_s, KEY_S},
+    {SDLK_t, KEY_T},
+    {SDLK_u, KEY_U},
+    {SDLK_v, KEY_V},
+    {SDLK_w, KEY_W},
+    {SDLK_x, KEY_X},
+    {SDLK_y, KEY_Y},
+    {SDLK_z, KEY_Z},
+
+    // Numbers
+    {SDLK_0, KEY_0},
+    {SDLK_1, KEY_1},
+    {SDLK_2, KEY_2},
+    {SDLK_3, KEY_3},
+    {SDLK_4, KEY_4},
+    {SDLK_5, KEY_5},
+    {SDLK_6, KEY_6},
+    {SDLK_7, KEY_7},
+    {SDLK_8, KEY_8},
+    {SDLK_9, KEY_9},
+
+    // Function keys
+    {SDLK_F1, KEY_F1},
+    {SDLK_F2, KEY_F2},
+    {SDLK_F3, KEY_F3},
+    {SDLK_F4, KEY_F4},
+    {SDLK_F5, KEY_F5},
+    {SDLK_F6, KEY_F6},
+    {SDLK_F7, KEY_F7},
+    {SDLK_F8, KEY_F8},
+    {SDLK_F9, KEY_F9},
+    {SDLK_F10, KEY_F10},
+    {SDLK_F11, KEY_F11},
+    {SDLK_F12, KEY_F12},
+
+    // Controls
+    {SDLK_ESCAPE, KEY_ESCAPE},
+    {SDLK_RETURN, KEY_ENTER},
+    {SDLK_TAB, KEY_TAB},
+    {SDLK_BACKSPACE, KEY_BACKSPACE},
+    {SDLK_INSERT, KEY_INSERT},
+    {SDLK_DELETE, KEY_DELETE},
+    {SDLK_RIGHT, KEY_RIGHT},
+    {SDLK_LEFT, KEY_LEFT},
+    {SDLK_DOWN, KEY_DOWN},
+    {SDLK_UP, KEY_UP},
+    {SDLK_PAGEUP, KEY_PAGE_UP},
+    {SDLK_PAGEDOWN, KEY_PAGE_DOWN},
+    {SDLK_HOME, KEY_HOME},
+    {SDLK_END, KEY_END},
+
+    // Modifiers
+    {SDLK_LSHIFT, KEY_LEFT_SHIFT},
+    {SDLK_RSHIFT, KEY_RIGHT_SHIFT},
+    {SDLK_LCTRL, KEY_LEFT_CTRL},
+    {SDLK_RCTRL, KEY_RIGHT_CTRL},
+    {SDLK_LALT, KEY_LEFT_ALT},
+    {SDLK_RALT, KEY_RIGHT_ALT},
+    {SDLK_LGUI, KEY_LEFT_SUPER},
+    {SDLK_RGUI, KEY_RIGHT_SUPER},
+    {SDLK_CAPSLOCK, KEY_CAPS_LOCK},
+    {SDLK_NUMLOCKCLEAR, KEY_NUM_LOCK},
+    {SDLK_SCROLLLOCK, KEY_SCROLL_LOCK},
+
+    // Symbols
+    {SDLK_SPACE, KEY_SPACE},
+    {SDLK_MINUS, KEY_MINUS},
+    {SDLK_EQUALS, KEY_EQUAL},
+    {SDLK_LEFTBRACKET, KEY_LEFT_BRACKET},
+    {SDLK_RIGHTBRACKET, KEY_RIGHT_BRACKET},
+    {SDLK_BACKSLASH, KEY_BACKSLASH},
+    {SDLK_SEMICOLON, KEY_SEMICOLON},
+    {SDLK_QUOTE, KEY_APOSTROPHE},
+    {SDLK_BACKQUOTE, KEY_GRAVE},
+    {SDLK_COMMA, KEY_COMMA},
+    {SDLK_PERIOD, KEY_PERIOD},
+    {SDLK_SLASH, KEY_SLASH},
+
+    // Keypad
+    {SDLK_KP_0, KEY_KP_0},
+    {SDLK_KP_1, KEY_KP_1},
+    {SDLK_KP_2, KEY_KP_2},
+    {SDLK_KP_3, KEY_KP_3},
+    {SDLK_KP_4, KEY_KP_4},
+    {SDLK_KP_5, KEY_KP_5},
+    {SDLK_KP_6, KEY_KP_6},
+    {SDLK_KP_7, KEY_KP_7},
+    {SDLK_KP_8, KEY_KP_8},
+    {SDLK_KP_9, KEY_KP_9},
+    {SDLK_KP_PERIOD, KEY_KP_DECIMAL},
+    {SDLK_KP_DIVIDE, KEY_KP_DIVIDE},
+    {SDLK_KP_MULTIPLY, KEY_KP_MULTIPLY},
+    {SDLK_KP_MINUS, KEY_KP_SUBTRACT},
+    {SDLK_KP_PLUS, KEY_KP_ADD},
+    {SDLK_KP_ENTER, KEY_KP_ENTER},
+};
+
+// SDL keycodes are either ASCII or a scancode tagged with SDLK_SCANCODE_MASK: one table per range
+inline constexpr auto sdlAsciiKeyTable = makeKeyTable<128>(sdlKeyMappings, 0);
+inline constexpr auto sdlScancodeKeyTable = makeKeyTable<SDL_NUM_SCANCODES>(sdlKeyMappings, SDLK_SCANCODE_MASK);
+
+} // namespace detail
+
 //! Map keys to SDL2
 inline Key mapSDLKey(SDL_Keycode sdlKey) {
-    switch (sdlKey) {
+    if (sdlKey & SDLK_SCANCODE_MASK) {
+        return detail::lookupKey(detail::sdlScancodeKeyTable, static_cast<u32>(sdlKey & ~SDLK_SCANCODE_MASK));
+    }
+    return detail::lookupKey(detail::sdlAsciiKeyTable, static_cast<u32>(sdlKey));
+}
+
+#endif
+
+#ifdef WMA_KEYSYM
+
+namespace detail {
+
+// Keysyms are shared by X11 and xkbcommon (Wayland)
+inline constexpr KeyMapping keysymKeyMappings[] = {
     // Letters
-    case SDLK_a: return Key::KEY_A;
-    case SDLK_b: return Key::KEY_B;
-    case SDLK_c: return Key::KEY_C;
-    case SDLK_d: return Key::KEY_D;
-    case SDLK_e: return Key::KEY_E;
-    case SDLK_f: return Key::KEY_F;
-    case SDLK_g: return Key::KEY_G;
-    case SDLK_h: return Key::KEY_H;
-    case SDLK_i: return Key::KEY_I;
-    case SDLK_j: return Key::KEY_J;
-    case SDLK_k: return Key::KEY_K;
-    case SDLK_l: return Key::KEY_L;
-    case SDLK_m: return Key::KEY_M;
-    case SDLK_n: return Key::KEY_N;
-    case SDLK_o: return Key::KEY_O;
-    case SDLK_p: return Key::KEY_P;
-    case SDLK_q: return Key::KEY_Q;
-    case SDLK_r: return Key::KEY_R;
-    case SDLK_s: return Key::KEY_S;
-    case SDLK_t: return Key::KEY_T;
-    case SDLK_u: return Key::KEY_U;
-    case SDLK_v: return Key::KEY_V;
-    case SDLK_w: return Key::KEY_W;
-    case SDLK_x: return Key::KEY_X;
-    case SDLK_y: return Key::KEY_Y;
-    case SDLK_z: return Key::KEY_Z;
-
-        // Numbers
-    case SDLK_0: return Key::KEY_0;
-    case SDLK_1: return Key::KEY_1;
-    case SDLK_2: return Key::KEY_2;
-    case SDLK_3: return Key::KEY_3;
-    case SDLK_4: return Key::KEY_4;
-    case SDLK_5: return Key::KEY_5;
-    case SDLK_6: return Key::KEY_6;
-    case SDLK_7: return Key::KEY_7;
-    case SDLK_8: return Key::KEY_8;
-    case SDLK_9: return Key::KEY_9;
-
-        // Function keys
-    case SDLK_F1: return Key::KEY_F1;
-    case SDLK_F2: return Key::KEY_F2;
-    case SDLK_F3: return Key::KEY_F3;
-    case SDLK_F4: return Key::KEY_F4;
-    case SDLK_F5: return Key::KEY_F5;
-    case SDLK_F6: return Key::KEY_F6;
-    case SDLK_F7: return Key::KEY_F7;
-    case SDLK_F8: return Key::KEY_F8;
-    case SDLK_F9: return Key::KEY_F9;
-    case SDLK_F10: return Key::KEY_F10;
-    case SDLK_F11: return Key::KEY_F11;
-    case SDLK_F12: return Key::KEY_F12;
-
-        // Controls
-    case SDLK_ESCAPE: return Key::KEY_ESCAPE;
-    case SDLK_RETURN: return Key::KEY_ENTER;
-    case SDLK_TAB: return Key::KEY_TAB;
-    case SDLK_BACKSPACE: return Key::KEY_BACKSPACE;
-    case SDLK_INSERT: return Key::KEY_INSERT;
-    case SDLK_DELETE: return Key::KEY_DELETE;
-    case SDLK_RIGHT: return Key::KEY_RIGHT;
-    case SDLK_LEFT: return Key::KEY_LEFT;
-    case SDLK_DOWN: return Key::KEY_DOWN;
-    case SDLK_UP: return Key::KEY_UP;
-    case SDLK_PAGEUP: return Key::KEY_PAGE_UP;
-    case SDLK_PAGEDOWN: return Key::KEY_PAGE_DOWN;
-    case SDLK_HOME: return Key::KEY_HOME;
-    case SDLK_END: return Key::KEY_END;
-
-        // Modifiers
-    case SDLK_LSHIFT: return Key::KEY_LEFT_SHIFT;
-    case SDLK_RSHIFT: return Key::KEY_RIGHT_SHIFT;
-    case SDLK_LCTRL: return Key::KEY_LEFT_CTRL;
-    case SDLK_RCTRL: return Key::KEY_RIGHT_CTRL;
-    case SDLK_LALT: return Key::KEY_LEFT_ALT;
-    case SDLK_RALT: return Key::KEY_RIGHT_ALT;
-    case SDLK_LGUI: return Key::KEY_LEFT_SUPER;
-    case SDLK_RGUI: return Key::KEY_RIGHT_SUPER;
-    case SDLK_CAPSLOCK: return Key::KEY_CAPS_LOCK;
-    case SDLK_NUMLOCKCLEAR: return Key::KEY_NUM_LOCK;
-    case SDLK_SCROLLLOCK: return Key::KEY_SCROLL_LOCK;
-
-        // Symbols
-    case SDLK_SPACE: return Key::KEY_SPACE;
-    case SDLK_MINUS: return Key::KEY_MINUS;
-    case SDLK_EQUALS: return Key::KEY_EQUAL;
-    case SDLK_LEFTBRACKET: return Key::KEY_LEFT_BRACKET;
-    case SDLK_RIGHTBRACKET: return Key::KEY_RIGHT_BRACKET;
-    case SDLK_BACKSLASH: return Key::KEY_BACKSLASH;
-    case SDLK_SEMICOLON: return Key::KEY_SEMICOLON;
-    case SDLK_QUOTE: return Key::KEY_APOSTROPHE;
-    case SDLK_BACKQUOTE: return Key::KEY_GRAVE;
-    case SDLK_COMMA: return Key::KEY_COMMA;
-    case SDLK_PERIOD: return Key::KEY_PERIOD;
-    case SDLK_SLASH: return Key::KEY_SLASH;
+    {WMA_KEYSYM(a), KEY_A},
+    {WMA_KEYSYM(b), KEY_B},
+    {WMA_KEYSYM(c), KEY_C},
+    {WMA_KEYSYM(d), KEY_D},
+    {WMA_KEYSYM(e), KEY_E},
+    {WMA_KEYSYM(f), KEY_F},
+    {WMA_KEYSYM(g), KEY_G},
+    {WMA_KEYSYM(h), KEY_H},
+    {WMA_KEYSYM(i), KEY_I},
+    {WMA_KEYSYM(j), KEY_J},
+    {WMA_KEYSYM(k), KEY_K},
+    {WMA_KEYSYM(l), KEY_L},
+    {WMA_KEYSYM(m), KEY_M},
+    {WMA_KEYSYM(n), KEY_N},
+    {WMA_KEYSYM(o), KEY_O},
+    {WMA_KEYSYM(p), KEY_P},
+    {WMA_KEYSYM(q), KEY_Q},
+    {WMA_KEYSYM(r), KEY_R},
+    {WMA_KEYSYM(s), KEY_S},
+    {WMA_KEYSYM(t), KEY_T},
+    {WMA_KEYSYM(u), KEY_U},
+    {WMA_KEYSYM(v), KEY_V},
+    {WMA_KEYSYM(w), KEY_W},
+    {WMA_KEYSYM(x), KEY_X},
+    {WMA_KEYSYM(y), KEY_Y},
+    {WMA_KEYSYM(z), KEY_Z},
+
+    // Numbers
+    {WMA_KEYSYM(0), KEY_0},
+    {WMA_KEYSYM(1), KEY_1},
+    {WMA_KEYSYM(2), KEY_2},
+    {WMA_KEYSYM(3), KEY_3},
+    {WMA_KEYSYM(4), KEY_4},
+    {WMA_KEYSYM(5), KEY_5},
+    {WMA_KEYSYM(6), KEY_6},
+    {WMA_KEYSYM(7), KEY_7},
+    {WMA_KEYSYM(8), KEY_8},
+    {WMA_KEYSYM(9), KEY_9},
+
+    // Function keys
+    {WMA_KEYSYM(F1), KEY_F1},
+    {WMA_KEYSYM(F2), KEY_F2},
+    {WMA_KEYSYM(F3), KEY_F3},
+    {WMA_KEYSYM(F4), KEY_F4},
+    {WMA_KEYSYM(F5), KEY_F5},
+    {WMA_KEYSYM(F6), KEY_F6},
+    {WMA_KEYSYM(F7), KEY_F7},
+    {WMA_KEYSYM(F8), KEY_F8},
+    {WMA_KEYSYM(F9), KEY_F9},
+    {WMA_KEYSYM(F10), KEY_F10},
+    {WMA_KEYSYM(F11), KEY_F11},
+    {WMA_KEYSYM(F12), KEY_F12},
+
+    // Controls
+    {WMA_KEYSYM(Escape), KEY_ESCAPE},
+    {WMA_KEYSYM(Return), KEY_ENTER}, // Main Enter key
+    {WMA_KEYSYM(Tab), KEY_TAB},
+    {WMA_KEYSYM(BackSpace), KEY_BACKSPACE},
+    {WMA_KEYSYM(Insert), KEY_INSERT},
+    {WMA_KEYSYM(Delete), KEY_DELETE},
+    {WMA_KEYSYM(Right), KEY_RIGHT},
+    {WMA_KEYSYM(Left), KEY_LEFT},
+    {WMA_KEYSYM(Down), KEY_DOWN},
+    {WMA_KEYSYM(Up), KEY_UP},
+    {WMA_KEYSYM(Page_Up), KEY_PAGE_UP},
+    {WMA_KEYSYM(Page_Down), KEY_PAGE_DOWN},
+    {WMA_KEYSYM(Home), KEY_HOME},
+    {WMA_KEYSYM(End), KEY_END},
+
+    // Modifiers
+    {WMA_KEYSYM(Shift_L), KEY_LEFT_SHIFT},
+    {WMA_KEYSYM(Shift_R), KEY_RIGHT_SHIFT},
+    {WMA_KEYSYM(Control_L), KEY_LEFT_CTRL},
+    {WMA_KEYSYM(Control_R), KEY_RIGHT_CTRL},
+    {WMA_KEYSYM(Alt_L), KEY_LEFT_ALT},
+    {WMA_KEYSYM(Alt_R), KEY_RIGHT_ALT},
+    {WMA_KEYSYM(Super_L), KEY_LEFT_SUPER},
+    {WMA_KEYSYM(Super_R), KEY_RIGHT_SUPER},
+    {WMA_KEYSYM(Caps_Lock), KEY_CAPS_LOCK},
+    {WMA_KEYSYM(Scroll_Lock), KEY_SCROLL_LOCK},
+    {WMA_KEYSYM(Num_Lock), KEY_NUM_LOCK},
+
+    // Symbols
+    {WMA_KEYSYM(space), KEY_SPACE},
+    {WMA_KEYSYM(minus), KEY_MINUS},
+    {WMA_KEYSYM(equal), KEY_EQUAL},
+    {WMA_KEYSYM(bracketleft), KEY_LEFT_BRACKET},
+    {WMA_KEYSYM(bracketright), KEY_RIGHT_BRACKET},
+    {WMA_KEYSYM(backslash), KEY_BACKSLASH},
+    {WMA_KEYSYM(semicolon), KEY_SEMICOLON},
+    {WMA_KEYSYM(apostrophe), KEY_APOSTROPHE},
+    {WMA_KEYSYM(grave), KEY_GRAVE},
+    {WMA_KEYSYM(comma), KEY_COMMA},
+    {WMA_KEYSYM(period), KEY_PERIOD},
+    {WMA_KEYSYM(slash), KEY_SLASH},
 
     // Keypad
-    case SDLK_KP_0: return Key::KEY_KP_0;
-    case SDLK_KP_1: return Key::KEY_KP_1;
-    case SDLK_KP_2: return Key::KEY_KP_2;
-    case SDLK_KP_3: return Key::KEY_KP_3;
-    case SDLK_KP_4: return Key::KEY_KP_4;
-    case SDLK_KP_5: return Key::KEY_KP_5;
-    case SDLK_KP_6: return Key::KEY_KP_6;
-    case SDLK_KP_7: return Key::KEY_KP_7;
-    case SDLK_KP_8: return Key::KEY_KP_8;
-    case SDLK_KP_9: return Key::KEY_KP_9;
-    case SDLK_KP_PERIOD: return Key::KEY_KP_DECIMAL;
-    case SDLK_KP_DIVIDE: return Key::KEY_KP_DIVIDE;
-    case SDLK_KP_MULTIPLY: return Key::KEY_KP_MULTIPLY;
-    case SDLK_KP_MINUS: return Key::KEY_KP_SUBTRACT;
-    case SDLK_KP_PLUS: return Key::KEY_KP_ADD;
-    case SDLK_KP_ENTER: return Key::KEY_KP_ENTER;
-
-    default: return Key::KEY_UNKNOWN;
+    {WMA_KEYSYM(KP_0), KEY_KP_0},
+    {WMA_KEYSYM(KP_1), KEY_KP_1},
+    {WMA_KEYSYM(KP_2), KEY_KP_2},
+    {WMA_KEYSYM(KP_3), KEY_KP_3},
+    {WMA_KEYSYM(KP_4), KEY_KP_4},
+    {WMA_KEYSYM(KP_5), KEY_KP_5},
+    {WMA_KEYSYM(KP_6), KEY_KP_6},
+    {WMA_KEYSYM(KP_7), KEY_KP_7},
+    {WMA_KEYSYM(KP_8), KEY_KP_8},
+    {WMA_KEYSYM(KP_9), KEY_KP_9},
+    {WMA_KEYSYM(KP_Decimal), KEY_KP_DECIMAL},
+    {WMA_KEYSYM(KP_Divide), KEY_KP_DIVIDE},
+    {WMA_KEYSYM(KP_Multiply), KEY_KP_MULTIPLY},
+    {WMA_KEYSYM(KP_Subtract), KEY_KP_SUBTRACT},
+    {WMA_KEYSYM(KP_Add), KEY_KP_ADD},
+    {WMA_KEYSYM(KP_Enter), KEY_KP_ENTER}, // Keypad Enter key
+};
+
+// Keysyms we map live in two 256-entry pages: Latin-1 (0x00xx) and the function keys (0xffxx)
+inline constexpr auto keysymLatinKeyTable = makeKeyTable<256>(keysymKeyMappings, 0x0000);
+inline constexpr auto keysymFunctionKeyTable = makeKeyTable<256>(keysymKeyMappings, 0xff00);
+
+} // namespace detail
+
+//! Map keysyms (X11 KeySym, xkb_keysym_t) to Key
+inline Key mapKeysym(u64 keysym) {
+    switch (keysym >> 8) {
+    case 0x00: return detail::lookupKey(detail::keysymLatinKeyTable, keysym & 0xff);
+    case 0xff: return detail::lookupKey(detail::keysymFunctionKeyTable, keysym & 0xff);
+    default:   return Key::KEY_UNKNOWN;
     }
 }
-
 #endif
 
 #ifdef WMA_ENABLE_X11
 //! Map keys to X11 KeySym
 inline Key mapX11Key(KeySym x11Key) {
-    switch (x11Key) {
+    return mapKeysym(x11Key);
+}
+#endif
+
+#ifdef WMA_ENABLE_WAYLAND
+
+namespace detail {
+
+// Linux evdev codes as sent by wl_keyboard.key, written out because the KEY_* macros of
+// <linux/input-event-codes.h> would clash with Key; the kernel names are in the comments
+inline constexpr KeyMapping evdevKeyMappings[] = {
     // Letters
-    case XK_a: return Key::KEY_A;
-    case XK_b: return Key::KEY_B;
-    case XK_c: return Key::KEY_C;
-    case XK_d: return Key::KEY_D;
-    case XK_e: return Key::KEY_E;
-    case XK_f: return Key::KEY_F;
-    case XK_g: return Key::KEY_G;
-    case XK_h: return Key::KEY_H;
-    case XK_i: return Key::KEY_I;
-    case XK_j: return Key::KEY_J;
-    case XK_k: return Key::KEY_K;
-    case XK_l: return Key::KEY_L;
-    case XK_m: return Key::KEY_M;
-    case XK_n: return Key::KEY_N;
-    case XK_o: return Key::KEY_O;
-    case XK_p: return Key::KEY_P;
-    case XK_q: return Key::KEY_Q;
-    case XK_r: return Key::KEY_R;
-    case XK_s: return Key::KEY_S;
-    case XK_t: return Key::KEY_T;
-    case XK_u: return Key::KEY_U;
-    case XK_v: return Key::KEY_V;
-    case XK_w: return Key::KEY_W;
-    case XK_x: return Key::KEY_X;
-    case XK_y: return Key::KEY_Y;
-    case XK_z: return Key::KEY_Z;
-
-        // Numbers
-    case XK_0: return Key::KEY_0;
-    case XK_1: return Key::KEY_1;
-    case XK_2: return Key::KEY_2;
-    case XK_3: return Key::KEY_3;
-    case XK_4: return Key::KEY_4;
-    case XK_5: return Key::KEY_5;
-    case XK_6: return Key::KEY_6;
-    case XK_7: return Key::KEY_7;
-    case XK_8: return Key::KEY_8;
-    case XK_9: return Key::KEY_9;
-
-        // Function keys
-    case XK_F1: return Key::KEY_F1;
-    case XK_F2: return Key::KEY_F2;
-    case XK_F3: return Key::KEY_F3;
-    case XK_F4: return Key::KEY_F4;
-    case XK_F5: return Key::KEY_F5;
-    case XK_F6: return Key::KEY_F6;
-    case XK_F7: return Key::KEY_F7;
-    case XK_F8: return Key::KEY_F8;
-    case XK_F9: return Key::KEY_F9;
-    case XK_F10: return Key::KEY_F10;
-    case XK_F11: return Key::KEY_F11;
-    case XK_F12: return Key::KEY_F12;
-
-        // Controls
-    case XK_Escape: return Key::KEY_ESCAPE;
-    case XK_Return: return Key::KEY_ENTER; // Main Enter key
-    case XK_Tab: return Key::KEY_TAB;
-    case XK_BackSpace: return Key::KEY_BACKSPACE;
-    case XK_Insert: return Key::KEY_INSERT;
-    case XK_Delete: return Key::KEY_DELETE;
-    case XK_Right: return Key::KEY_RIGHT;
-    case XK_Left: return Key::KEY_LEFT;
-    case XK_Down: return Key::KEY_DOWN;
-    case XK_Up: return Key::KEY_UP;
-    case XK_Page_Up: return Key::KEY_PAGE_UP;
-    case XK_Page_Down: return Key::KEY_PAGE_DOWN;
-    case XK_Home: return Key::KEY_HOME;
-    case XK_End: return Key::KEY_END;
-
-        // Modifiers
-    case XK_Shift_L: return Key::KEY_LEFT_SHIFT;
-    case XK_Shift_R: return Key::KEY_RIGHT_SHIFT;
-    case XK_Control_L: return Key::KEY_LEFT_CTRL;
-    case XK_Control_R: return Key::KEY_RIGHT_CTRL;
-    case XK_Alt_L: return Key::KEY_LEFT_ALT;
-    case XK_Alt_R: return Key::KEY_RIGHT_ALT;
-    case XK_Super_L: return Key::KEY_LEFT_SUPER;
-    case XK_Super_R: return Key::KEY_RIGHT_SUPER;
-    case XK_Caps_Lock: return Key::KEY_CAPS_LOCK;
-    case XK_Scroll_Lock: return Key::KEY_SCROLL_LOCK;
-    case XK_Num_Lock: return Key::KEY_NUM_LOCK;
-
-        // Symbols
-    case XK_space: return Key::KEY_SPACE;
-    case XK_minus: return Key::KEY_MINUS;
-    case XK_equal: return Key::KEY_EQUAL;
-    case XK_bracketleft: return Key::KEY_LEFT_BRACKET;
-    case XK_bracketright: return Key::KEY_RIGHT_BRACKET;
-    case XK_backslash: return Key::KEY_BACKSLASH;
-    case XK_semicolon: return Key::KEY_SEMICOLON;
-    case XK_apostrophe: return Key::KEY_APOSTROPHE;
-    case XK_grave: return Key::KEY_GRAVE;
-    case XK_comma: return Key::KEY_COMMA;
-    case XK_period: return Key::KEY_PERIOD;
-    case XK_slash: return Key::KEY_SLASH;
-
-        // Keypad
-    case XK_KP_0: return Key::KEY_KP_0;
-    case XK_KP_1: return Key::KEY_KP_1;
-    case XK_KP_2: return Key::KEY_KP_2;
-    case XK_KP_3: return Key::KEY_KP_3;
-    case XK_KP_4: return Key::KEY_KP_4;
-    case XK_KP_5: return Key::KEY_KP_5;
-    case XK_KP_6: return Key::KEY_KP_6;
-    case XK_KP_7: return Key::KEY_KP_7;
-    case XK_KP_8: return Key::KEY_KP_8;
-    case XK_KP_9: return Key::KEY_KP_9;
-    case XK_KP_Decimal: return Key::KEY_KP_DECIMAL;
-    case XK_KP_Divide: return Key::KEY_KP_DIVIDE;
-    case XK_KP_Multiply: return Key::KEY_KP_MULTIPLY;
-    case XK_KP_Subtract: return Key::KEY_KP_SUBTRACT;
-    case XK_KP_Add: return Key::KEY_KP_ADD;
-    case XK_KP_Enter: return Key::KEY_KP_ENTER; // Keypad Enter key
-
-    default: return Key::KEY_UNKNOWN;
-    }
+    {30, KEY_A}, // KEY_A
+    {48, KEY_B}, // KEY_B
+    {46, KEY_C}, // KEY_C
+    {32, KEY_D}, // KEY_D
+    {18, KEY_E}, // KEY_E
+    {33, KEY_F}, // KEY_F
+    {34, KEY_G}, // KEY_G
+    {35, KEY_H}, // KEY_H
+    {23, KEY_I}, // KEY_I
+    {36, KEY_J}, // KEY_J
+    {37, KEY_K}, // KEY_K
+    {38, KEY_L}, // KEY_L
+    {50, KEY_M}, // KEY_M
+    {49, KEY_N}, // KEY_N
+    {24, KEY_O}, // KEY_O
+    {25, KEY_P}, // KEY_P
+    {16, KEY_Q}, // KEY_Q
+    {19, KEY_R}, // KEY_R
+    {31, KEY_S}, // KEY_S
+    {20, KEY_T}, // KEY_T
+    {22, KEY_U}, // KEY_U
+    {47, KEY_V}, // KEY_V
+    {17, KEY_W}, // KEY_W
+    {45, KEY_X}, // KEY_X
+    {21, KEY_Y}, // KEY_Y
+    {44, KEY_Z}, // KEY_Z
+
+    // Numbers
+    {11, KEY_0}, // KEY_0
+    {2, KEY_1}, // KEY_1
+    {3, KEY_2}, // KEY_2
+    {4, KEY_3}, // KEY_3
+    {5, KEY_4}, // KEY_4
+    {6, KEY_5}, // KEY_5
+    {7, KEY_6}, // KEY_6
+    {8, KEY_7}, // KEY_7
+    {9, KEY_8}, // KEY_8
+    {10, KEY_9}, // KEY_9
+
+    // Function keys
+    {59, KEY_F1}, // KEY_F1
+    {60, KEY_F2}, // KEY_F2
+    {61, KEY_F3}, // KEY_F3
+    {62, KEY_F4}, // KEY_F4
+    {63, KEY_F5}, // KEY_F5
+    {64, KEY_F6}, // KEY_F6
+    {65, KEY_F7}, // KEY_F7
+    {66, KEY_F8}, // KEY_F8
+    {67, KEY_F9}, // KEY_F9
+    {68, KEY_F10}, // KEY_F10
+    {87, KEY_F11}, // KEY_F11
+    {88, KEY_F12}, // KEY_F12
+
+    // Controls
+    {1, KEY_ESCAPE}, // KEY_ESC
+    {28, KEY_ENTER}, // KEY_ENTER
+    {15, KEY_TAB}, // KEY_TAB
+    {14, KEY_BACKSPACE}, // KEY_BACKSPACE
+    {110, KEY_INSERT}, // KEY_INSERT
+    {111, KEY_DELETE}, // KEY_DELETE
+    {106, KEY_RIGHT}, // KEY_RIGHT
+    {105, KEY_LEFT}, // KEY_LEFT
+    {108, KEY_DOWN}, // KEY_DOWN
+    {103, KEY_UP}, // KEY_UP
+    {104, KEY_PAGE_UP}, // KEY_PAGEUP
+    {109, KEY_PAGE_DOWN}, // KEY_PAGEDOWN
+    {102, KEY_HOME}, // KEY_HOME
+    {107, KEY_END}, // KEY_END
+
+    // Modifiers
+    {42, KEY_LEFT_SHIFT}, // KEY_LEFTSHIFT
+    {54, KEY_RIGHT_SHIFT}, // KEY_RIGHTSHIFT
+    {29, KEY_LEFT_CTRL}, // KEY_LEFTCTRL
+    {97, KEY_RIGHT_CTRL}, // KEY_RIGHTCTRL
+    {56, KEY_LEFT_ALT}, // KEY_LEFTALT
+    {100, KEY_RIGHT_ALT}, // KEY_RIGHTALT
+    {125, KEY_LEFT_SUPER}, // KEY_LEFTMETA
+    {126, KEY_RIGHT_SUPER}, // KEY_RIGHTMETA
+    {58, KEY_CAPS_LOCK}, // KEY_CAPSLOCK
+    {70, KEY_SCROLL_LOCK}, // KEY_SCROLLLOCK
+    {69, KEY_NUM_LOCK}, // KEY_NUMLOCK
+
+    // Symbols
+    {57, KEY_SPACE}, // KEY_SPACE
+    {12, KEY_MINUS}, // KEY_MINUS
+    {13, KEY_EQUAL}, // KEY_EQUAL
+    {26, KEY_LEFT_BRACKET}, // KEY_LEFTBRACE
+    {27, KEY_RIGHT_BRACKET}, // KEY_RIGHTBRACE
+    {43, KEY_BACKSLASH}, // KEY_BACKSLASH
+    {39, KEY_SEMICOLON}, // KEY_SEMICOLON
+    {40, KEY_APOSTROPHE}, // KEY_APOSTROPHE
+    {41, KEY_GRAVE}, // KEY_GRAVE
+    {51, KEY_COMMA}, // KEY_COMMA
+    {52, KEY_PERIOD}, // KEY_DOT
+    {53, KEY_SLASH}, // KEY_SLASH
+
+    // Keypad
+    {82, KEY_KP_0}, // KEY_KP0
+    {79, KEY_KP_1}, // KEY_KP1
+    {80, KEY_KP_2}, // KEY_KP2
+    {81, KEY_KP_3}, // KEY_KP3
+    {75, KEY_KP_4}, // KEY_KP4
+    {76, KEY_KP_5}, // KEY_KP5
+    {77, KEY_KP_6}, // KEY_KP6
+    {71, KEY_KP_7}, // KEY_KP7
+    {72, KEY_KP_8}, // KEY_KP8
+    {73, KEY_KP_9}, // KEY_KP9
+    {83, KEY_KP_DECIMAL}, // KEY_KPDOT
+    {98, KEY_KP_DIVIDE}, // KEY_KPSLASH
+    {55, KEY_KP_MULTIPLY}, // KEY_KPASTERISK
+    {74, KEY_KP_SUBTRACT}, // KEY_KPMINUS
+    {78, KEY_KP_ADD}, // KEY_KPPLUS
+    {96, KEY_KP_ENTER}, // KEY_KPENTER
+};
+
+// Keyboard evdev codes are dense below 256
+inline constexpr auto evdevKeyTable = makeKeyTable<256>(evdevKeyMappings, 0);
+
+} // namespace detail
+
+//! Map Linux evdev key codes (wl_keyboard.key) to Key
+inline Key mapWaylandKey(u32 evdevKey) {
+    return detail::lookupKey(detail::evdevKeyTable, evdevKey);
 }
 #endif
 
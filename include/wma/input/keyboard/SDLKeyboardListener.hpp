@@ -12,7 +12,7 @@ namespace wma {
 /**
  * @brief SDL2-specific keyboard listener implementation
  */
-class SDLKeyboardListener : public KeyboardListener {
+class SDLKeyboardListener final : public KeyboardListener {
 public:
     SDLKeyboardListener();
     ~SDLKeyboardListener() override = default;
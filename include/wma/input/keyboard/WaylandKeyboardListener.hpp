@@ -2,14 +2,27 @@
 #define WMA_INPUT_WAYLAND_KEYBOARD_LISTENER_HPP
 
 #include "wma/input/keyboard/KeyboardListener.hpp"
+#include "wma/core/Reactor.hpp"
+#include <array>
 #include <wayland-client.h>
 
+#define WMA_XKB_KEYMAP_CACHE_SIZE 4  // compiled keymaps kept per keyboard, keyed by content hash
+#define WMA_KEY_REPEAT_RATE 25       // repeats per second until the compositor sends repeat_info
+#define WMA_KEY_REPEAT_DELAY 600     // milliseconds before the first repeat
+
+struct xkb_context;
+struct xkb_keymap;
+struct xkb_state;
+
 namespace wma {
 
 /**
  * @brief Wayland-specific keyboard listener implementation
+ *
+ * Wayland leaves key repeat to the client: the last pressed key is repeated
+ * from a reactor timer (a timerfd) at the rate and delay of repeat_info.
  */
-class WaylandKeyboardListener : public KeyboardListener {
+class WaylandKeyboardListener final : public KeyboardListener {
 public:
     WaylandKeyboardListener();
     ~WaylandKeyboardListener() override;
@@ -17,8 +30,9 @@ public:
     /**
      * @brief Initialize the listener with a Wayland keyboard
      * @param keyboard The Wayland keyboard object
+     * @param reactor Reactor driving key repeat, nullptr disables repeat
      */
-    void initialize(wl_keyboard* keyboard);
+    void initialize(wl_keyboard* keyboard, Reactor* reactor = nullptr);
 
     /**
      * @brief Get the Wayland keyboard object
@@ -26,6 +40,11 @@ public:
      */
     wl_keyboard* getKeyboard() const { return keyboard_; }
 
+    /**
+     * @brief xkb state tracking the compositor's modifiers and layout, nullptr before the first keymap
+     */
+    xkb_state* getXkbState() const { return xkbState_; }
+
     // Wayland keyboard event handlers
     void handleKeymap(uint32_t format, int32_t fd, uint32_t size);
     void handleEnter(uint32_t serial, wl_surface* surface, wl_array* keys);
@@ -36,8 +55,41 @@ public:
     void handleRepeatInfo(int32_t rate, int32_t delay);
 
 private:
+    struct CachedKeymap {
+        u64 hash = 0;
+        u32 size = 0;
+        xkb_keymap* keymap = nullptr;
+    };
+
     wl_keyboard* keyboard_ = nullptr;
 
+    xkb_context* xkbContext_ = nullptr;
+    xkb_keymap* xkbKeymap_ = nullptr;  // Active keymap (own reference)
+    xkb_state* xkbState_ = nullptr;
+    u32 xkbLayout_ = 0;                // Effective layout the key table was built for
+
+    std::array<CachedKeymap, WMA_XKB_KEYMAP_CACHE_SIZE> keymapCache_;
+    u32 keymapCacheNext_ = 0;
+
+    // evdev code -> Key for the active layout; starts as the layout independent evdev table
+    std::array<i8, 256> keyTable_;
+
+    // Key repeat
+    Reactor* reactor_ = nullptr;
+    i32 repeatRate_ = WMA_KEY_REPEAT_RATE;    // 0 disables repeat
+    i32 repeatDelay_ = WMA_KEY_REPEAT_DELAY;
+    i32 repeatTimer_ = -1;                    // Reactor timer id, -1 when no key repeats
+    u32 repeatKey_ = 0;                       // evdev code of the repeating key
+    u64 repeatDue_ = 0;                       // Scheduled time of the next repeat (InputClock ns)
+    u64 repeatIntervalNs_ = 0;
+
+    void startRepeat(u32 evdevKey);
+    void stopRepeat();
+
+    xkb_keymap* findOrCompileKeymap(const char* text, u32 size);
+    void setKeymap(xkb_keymap* keymap);
+    void rebuildKeyTable();
+
     // Wayland keyboard listener callbacks
     static const wl_keyboard_listener keyboardListener_;
 
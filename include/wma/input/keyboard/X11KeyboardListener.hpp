@@ -3,6 +3,7 @@
 #define WMA_INPUT_X11_KEYBOARD_LISTENER_HPP
 
 #include "wma/input/keyboard/KeyboardListener.hpp"
+#include <array>
 #include <X11/Xlib.h>
 #include <X11/keysym.h>
 
@@ -10,27 +11,54 @@ namespace wma {
 
 /**
  * @brief X11-specific keyboard listener implementation
+ *
+ * Auto repeat is reported as repeats: with XKB detectable auto repeat the
+ * server sends repeated KeyPress events only, otherwise the KeyRelease /
+ * KeyPress pair it sends per repeat is recognised by peeking at the queue.
  */
-class X11KeyboardListener : public KeyboardListener {
+class X11KeyboardListener final : public KeyboardListener {
 public:
     X11KeyboardListener();
     ~X11KeyboardListener() override = default;
 
     /**
-     * @brief Initialize the listener with an X11 display
+     * @brief Initialize the listener with an X11 display, build the keycode table and enable detectable auto repeat
      * @param display The X11 display to attach to
      */
     void initialize(Display* display);
 
+    /**
+     * @brief Rebuild the keycode table from the server's keyboard mapping
+     *
+     * Called from initialize() and on MappingNotify (layout change).
+     * Does not throw: if the server does not return a mapping the previous
+     * table stays in place.
+     *
+     * @return false if the mapping could not be read
+     */
+    bool rebuildKeymap();
+
     /**
      * @brief Handle X11 keyboard events
-     * @param x11Key The X11 KeySym
+     *
+     * Without detectable auto repeat, a KeyRelease may consume the KeyPress
+     * queued right behind it (same keycode and timestamp) as one repeat.
+     *
      * @param xKeyEvent The X11 key event
      */
-    void handleKeyEvent(KeySym x11Key, const XKeyEvent& xKeyEvent);
+    void handleKeyEvent(const XKeyEvent& xKeyEvent);
+
+    /**
+     * @brief Check if the server suppresses the KeyRelease of auto repeats
+     */
+    bool hasDetectableAutoRepeat() const { return detectableAutoRepeat_; }
 
 private:
     Display* display_ = nullptr;
+    bool detectableAutoRepeat_ = false;
+
+    // Keycode -> Key, translating the unshifted keysym (what XLookupKeysym(event, 0) returns)
+    std::array<i8, 256> keycodeTable_;
 };
 
 } // namespace wma
@@ -8,7 +8,7 @@ struct GLFWwindow;
 
 namespace wma {
 
-class GLFWMouseListener : public MouseListener {
+class GLFWMouseListener final : public MouseListener {
 public:
     GLFWMouseListener();
     ~GLFWMouseListener() override;
@@ -1,10 +1,12 @@
 #ifndef WMA_INPUT_MOUSE_ACTION_HPP
 #define WMA_INPUT_MOUSE_ACTION_HPP
 
-#include <functional>
+#include <variant>
 #include <ink/ink_base.hpp>
 #include <ink/Inkogger.h>
 
+#include "wma/core/InplaceFunction.hpp"
+
 namespace wma {
 
 /**
@@ -15,18 +17,39 @@ struct WMAMousePosition {
     f64 y = 0.0;
     f64 deltaX = 0.0;
     f64 deltaY = 0.0;
+    u64 timestamp = 0;  // When the device produced it, InputClock nanoseconds (see InputClock.hpp)
 
     WMAMousePosition() = default;
-    WMAMousePosition(f64 x, f64 y, f64 deltaX = 0.0, f64 deltaY = 0.0)
-        : x(x), y(y), deltaX(deltaX), deltaY(deltaY) {}
+    WMAMousePosition(f64 x, f64 y, f64 deltaX = 0.0, f64 deltaY = 0.0, u64 timestamp = 0)
+        : x(x), y(y), deltaX(deltaX), deltaY(deltaY), timestamp(timestamp) {}
+};
+
+/**
+ * @brief Device a scroll comes from, when the backend reports it (Wayland)
+ */
+enum WMAScrollSource : i32 {
+    WMAScrollSourceUnknown = 0,
+    WMAScrollSourceWheel,       // Notched wheel
+    WMAScrollSourceFinger,      // Touchpad; ends with a stop event
+    WMAScrollSourceContinuous,  // e.g. button + motion scrolling
+    WMAScrollSourceWheelTilt    // Sideways wheel push
 };
 
 /**
  * @brief Mouse scroll data
+ *
+ * Offsets are in wheel steps, up / right positive. High-resolution wheels
+ * and smooth (touchpad) scrolling report fractions of a step where the
+ * backend supports it (Wayland, X11 with XInput2, SDL, GLFW).
  */
 struct WMAMouseScroll {
     f64 xOffset = 0.0;
     f64 yOffset = 0.0;
+    f64 pixelX = 0.0;   // Continuous distance in surface pixels, same orientation (Wayland only)
+    f64 pixelY = 0.0;
+    WMAScrollSource source = WMAScrollSourceUnknown;
+    bool stop = false;  // Finger / continuous scroll ended (zero offsets): kinetic scrolling can start
+    u64 timestamp = 0;  // InputClock nanoseconds, like WMAMousePosition
 
     WMAMouseScroll() = default;
     WMAMouseScroll(f64 xOffset, f64 yOffset)
@@ -35,25 +58,58 @@ struct WMAMouseScroll {
 
 /**
  * @brief Encapsulates mouse button press, release, and movement actions
+ *
+ * An action is one of button (press/release), move or scroll; only the
+ * callbacks of that kind are stored.
  */
 class MouseAction {
 public:
-    using WMAButtonCallback = std::function<void()>;
-    using WMAPositionCallback = std::function<void(const WMAMousePosition&)>;
-    using WMAScrollCallback = std::function<void(const WMAMouseScroll&)>;
+    using WMAButtonCallback = InplaceFunction<void()>;
+    using WMAPositionCallback = InplaceFunction<void(const WMAMousePosition&)>;
+    using WMAScrollCallback = InplaceFunction<void(const WMAMouseScroll&)>;
+
+    // Plain function pointers for the context constructors
+    using WMAButtonContextCallback = void (*)(void* context);
+    using WMAPositionContextCallback = void (*)(void* context, const WMAMousePosition& position);
+    using WMAScrollContextCallback = void (*)(void* context, const WMAMouseScroll& scroll);
 
     MouseAction() = default;
 
     MouseAction(WMAButtonCallback onPress,
                 WMAButtonCallback onRelease)
-        : onPress_(std::move(onPress))
-        , onRelease_(std::move(onRelease)) {}
+        : callbacks_(WMAButtonCallbacks{std::move(onPress), std::move(onRelease)}) {}
 
     explicit MouseAction(WMAPositionCallback onMove)
-        : onMove_(std::move(onMove)) {}
+        : callbacks_(std::move(onMove)) {}
 
     explicit MouseAction(WMAScrollCallback onScroll)
-        : onScroll_(std::move(onScroll)) {}
+        : callbacks_(std::move(onScroll)) {}
+
+    /**
+     * @brief Function pointers sharing one context, e.g. a std::function too large to store inline
+     *
+     * The context must outlive the action. Templated on the context so a
+     * literal nullptr still selects the callback constructors above.
+     *
+     * @code
+     * std::function<void(const WMAMousePosition&)> onMove = ...;
+     * MouseAction action(&onMove, [](void* f, const WMAMousePosition& p) {
+     *     (*static_cast<std::function<void(const WMAMousePosition&)>*>(f))(p);
+     * });
+     * @endcode
+     */
+    template <typename Context>
+    MouseAction(Context* context, WMAButtonContextCallback onPress, WMAButtonContextCallback onRelease = nullptr)
+        : callbacks_(WMAButtonCallbacks{bind<WMAButtonCallback>(context, onPress),
+                                        bind<WMAButtonCallback>(context, onRelease)}) {}
+
+    template <typename Context>
+    MouseAction(Context* context, WMAPositionContextCallback onMove)
+        : callbacks_(bind<WMAPositionCallback>(context, onMove)) {}
+
+    template <typename Context>
+    MouseAction(Context* context, WMAScrollContextCallback onScroll)
+        : callbacks_(bind<WMAScrollCallback>(context, onScroll)) {}
 
     // Copy constructor
     MouseAction(const MouseAction& other) = default;
@@ -70,55 +126,87 @@ public:
     /**
      * @brief Check if press action is available
      */
-    bool hasPressAction() const    { return static_cast<bool>(onPress_); }
+    bool hasPressAction() const {
+        const auto* buttons = std::get_if<WMAButtonCallbacks>(&callbacks_);
+        return buttons && buttons->onPress;
+    }
 
     /**
      * @brief Check if release action is available
      */
-    bool hasReleaseAction() const  { return static_cast<bool>(onRelease_); }
+    bool hasReleaseAction() const {
+        const auto* buttons = std::get_if<WMAButtonCallbacks>(&callbacks_);
+        return buttons && buttons->onRelease;
+    }
+
     /**
      * @brief Check if movement action is available
      */
-    bool hasMoveAction() const     { return static_cast<bool>(onMove_); }
+    bool hasMoveAction() const {
+        const auto* onMove = std::get_if<WMAPositionCallback>(&callbacks_);
+        return onMove && *onMove;
+    }
 
     /**
      * @brief Check if scroll action is available
      */
-    bool hasScrollAction() const   { return static_cast<bool>(onScroll_); }
+    bool hasScrollAction() const {
+        const auto* onScroll = std::get_if<WMAScrollCallback>(&callbacks_);
+        return onScroll && *onScroll;
+    }
 
     /**
      * @brief Execute the press action if available
      */
     void executePress() const {
-        onPress_();
+        if (hasPressAction()) {
+            std::get<WMAButtonCallbacks>(callbacks_).onPress();
+        }
     }
 
     /**
      * @brief Execute the release action if available
      */
     void executeRelease() const {
-        onRelease_();
+        if (hasReleaseAction()) {
+            std::get<WMAButtonCallbacks>(callbacks_).onRelease();
+        }
     }
 
     /**
      * @brief Execute the movement action if available
      */
     void executeMove(const WMAMousePosition& position) const {
-        onMove_(position);
+        if (hasMoveAction()) {
+            std::get<WMAPositionCallback>(callbacks_)(position);
+        }
     }
 
     /**
      * @brief Execute the scroll action if available
      */
     void executeScroll(const WMAMouseScroll& scroll) const {
-        onScroll_(scroll);
+        if (hasScrollAction()) {
+            std::get<WMAScrollCallback>(callbacks_)(scroll);
+        }
     }
 
 private:
-    WMAButtonCallback onPress_;
-    WMAButtonCallback onRelease_;
-    WMAPositionCallback onMove_;
-    WMAScrollCallback onScroll_;
+    struct WMAButtonCallbacks {
+        WMAButtonCallback onPress;
+        WMAButtonCallback onRelease;
+    };
+
+    template <typename Callback, typename Context, typename Fn>
+    static Callback bind(Context* context, Fn callback) {
+        if (callback == nullptr) {
+            return nullptr;
+        }
+        void* data = static_cast<void*>(context);
+        return Callback([data, callback](const auto&... args) { callback(data, args...); });
+    }
+
+    std::variant<std::monostate, WMAButtonCallbacks, WMAPositionCallback, WMAScrollCallback> callbacks_;
 };
 
 /**
@@ -133,6 +221,8 @@ namespace MouseButton {
     constexpr i32 WMAButton6 = 5;
     constexpr i32 WMAButton7 = 6;
     constexpr i32 WMAButton8 = 7;
+
+    constexpr i32 WMAButtonCount = 8; // Size of per-button tables
 }
 
 } // namespace wma
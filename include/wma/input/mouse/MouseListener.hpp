@@ -2,7 +2,15 @@
 #define WMA_INPUT_MOUSE_LISTENER_HPP
 
 #include "MouseAction.hpp"
-#include <unordered_map>
+#include "wma/core/InputClock.hpp"
+#include "wma/core/LatencyHistogram.hpp"
+#include <array>
+#include <bitset>
+#include <cstddef>
+
+#ifndef WMA_MOTION_SAMPLE_CAPACITY
+#define WMA_MOTION_SAMPLE_CAPACITY 256  // coalesced motion samples kept per frame (8 kHz mouse at 30 fps)
+#endif
 
 namespace wma {
 
@@ -18,6 +26,7 @@ struct PendingEvent {
     WMAMousePosition position{};
     WMAMouseScroll scroll{};
     i32 button = -1;
+    u64 timestamp = 0;  // InputClock nanoseconds
 
     PendingEvent() = default;
     explicit PendingEvent(WMAType t) : type(t) {}
@@ -26,12 +35,26 @@ struct PendingEvent {
     PendingEvent(WMAType t, i32 btn) : type(t), button(btn) {}
 };
 
+/**
+ * @brief Read-only view over the motion samples coalesced into one move
+ */
+struct WMAMotionSamples {
+    const WMAMousePosition* data = nullptr;
+    size_t count = 0;
+
+    const WMAMousePosition* begin() const { return data; }
+    const WMAMousePosition* end() const { return data + count; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    const WMAMousePosition& operator[](size_t index) const { return data[index]; }
+};
+
 class MouseListener {
 public:
     MouseListener();
     virtual ~MouseListener();
 
-    // Action management
+    // Action management (button in [0, MouseButton::WMAButtonCount), InputException otherwise)
     void addButtonAction(i32 button, MouseAction action);
     void removeButtonAction(i32 button);
     void setMoveAction(MouseAction action);
@@ -46,6 +69,61 @@ public:
     void setSensitivity(f64 sensitivity);
     f64 getSensitivity() const;
 
+    /**
+     * @brief Device timestamp of the event being dispatched (InputClock ns)
+     *
+     * Valid inside every mouse callback, buttons included; moves and
+     * scrolls also carry it in their timestamp field. The GLFW backend has
+     * no device times and reports the arrival time.
+     */
+    u64 getEventTime() const { return eventTime_; }
+
+    /**
+     * @brief How long events waited between their device timestamp and dispatch, per event class
+     *
+     * Coalesced motion is recorded per sample when the frame's move runs.
+     * Snapshot them from any thread.
+     */
+    const LatencyHistogram& getButtonLatency() const { return buttonLatency_; }
+    const LatencyHistogram& getMotionLatency() const { return motionLatency_; }
+    const LatencyHistogram& getScrollLatency() const { return scrollLatency_; }
+
+    /**
+     * @brief Relative mouse mode for camera control (off by default)
+     *
+     * Hides and captures the cursor; move deltas become unaccelerated,
+     * sub-pixel where the platform allows, and do not stop at the screen
+     * edge: XI_RawMotion on X11 (XInput2), zwp_relative_pointer_v1 with a
+     * pointer lock on Wayland, SDL relative mode, GLFW raw mouse motion.
+     */
+    void setRelativeMode(bool enabled);
+    bool isRelativeMode() const { return relativeMode_; }
+
+    /**
+     * @brief Coalesce motion into at most one move callback per frame (off by default)
+     *
+     * The move action then runs from the window manager's pollEvents() with
+     * the latest position and the summed deltas, and the raw samples behind
+     * it stay readable through getMotionSamples() until the next pollEvents().
+     */
+    void setMotionCoalescing(bool enabled);
+    bool isMotionCoalescing() const { return coalesceMotion_; }
+
+    /**
+     * @brief Samples merged into the last coalesced move, empty if the frame had no motion
+     *
+     * Past WMA_MOTION_SAMPLE_CAPACITY samples the last one is overwritten,
+     * so the span always ends at the current position. Empty when coalescing is off.
+     */
+    WMAMotionSamples getMotionSamples() const {
+        return WMAMotionSamples{motionSamples_[publishedSamples_].data(), motionSampleCount_[publishedSamples_]};
+    }
+
+    /**
+     * @brief Deliver the coalesced move and publish its samples; called by the window manager's pollEvents()
+     */
+    void flushMotion();
+
     // Event processing
     void processPendingEvents(const PendingEvent& event);
 
@@ -53,8 +131,44 @@ protected:
     // Platform-specific methods to be overridden
     virtual void updateCursorState() = 0;
 
+    // Shared motion path of the backends: updates the position and runs (or coalesces) the move action
+    void dispatchMotion(f64 xpos, f64 ypos, u64 timestamp);
+
+    // Raw device deltas (y down) for relative mode; positions keep coming through dispatchMotion
+    void dispatchRelativeMotion(f64 dx, f64 dy, u64 timestamp);
+
+    // Shared button and scroll paths; the scroll carries its own timestamp
+    void dispatchButton(i32 button, bool pressed, u64 timestamp) {
+        buttonLatency_.recordSince(timestamp);
+        if (const MouseAction* action = findButtonAction(button)) {
+            eventTime_ = timestamp;
+            if (pressed) {
+                action->executePress();
+            } else {
+                action->executeRelease();
+            }
+        }
+    }
+
+    void dispatchScroll(const WMAMouseScroll& scroll) {
+        scrollLatency_.recordSince(scroll.timestamp);
+        if (scrollAction_.hasScrollAction()) {
+            eventTime_ = scroll.timestamp;
+            scrollAction_.executeScroll(scroll);
+        }
+    }
+
+    // Bound action for a button, nullptr if none
+    const MouseAction* findButtonAction(i32 button) const {
+        if (static_cast<u32>(button) >= static_cast<u32>(MouseButton::WMAButtonCount) || !boundButtons_.test(button)) {
+            return nullptr;
+        }
+        return &buttonActions_[button];
+    }
+
     // Core state
-    std::unordered_map<i32, MouseAction> buttonActions_;
+    std::array<MouseAction, MouseButton::WMAButtonCount> buttonActions_;
+    std::bitset<MouseButton::WMAButtonCount> boundButtons_;
     MouseAction moveAction_;
     MouseAction scrollAction_;
 
@@ -64,6 +178,28 @@ protected:
     bool cursorEnabled_ = true;
     f64 sensitivity_ = 1.0;
     bool firstMouse_ = true;
+
+    u64 eventTime_ = 0;
+    InputClockMapper deviceClock_;  // Millisecond, 32-bit event times of X11, Wayland and SDL
+
+    LatencyHistogram buttonLatency_;
+    LatencyHistogram motionLatency_;
+    LatencyHistogram scrollLatency_;
+
+    bool relativeMode_ = false;
+    bool rawMotionActive_ = false;  // Set by a backend feeding dispatchRelativeMotion: absolute motion only tracks the position
+
+    // Motion coalescing: samples are collected into one buffer while the other is published
+    bool coalesceMotion_ = false;
+    bool motionPending_ = false;
+    WMAMousePosition pendingMotion_;
+    std::array<std::array<WMAMousePosition, WMA_MOTION_SAMPLE_CAPACITY>, 2> motionSamples_;
+    std::array<u32, 2> motionSampleCount_{};
+    u32 publishedSamples_ = 0;
+
+private:
+    // Runs or coalesces the move action for currentPosition_
+    void deliverMotion();
 };
 
 } // namespace wma
@@ -9,7 +9,7 @@ union SDL_Event;
 
 namespace wma {
 
-class SDLMouseListener : public MouseListener {
+class SDLMouseListener final : public MouseListener {
 public:
     SDLMouseListener();
     ~SDLMouseListener() override = default;
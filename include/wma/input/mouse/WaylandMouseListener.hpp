@@ -2,14 +2,34 @@
 #define WMA_INPUT_WAYLAND_MOUSE_LISTENER_HPP
 
 #include "wma/input/mouse/MouseListener.hpp"
+#include <array>
 #include <wayland-client.h>
+#include "wma/managers/relative-pointer-unstable-v1-client-protocol.h"
+#include "wma/managers/pointer-constraints-unstable-v1-client-protocol.h"
+
+#define WMA_WAYLAND_SCROLL_STEP_PIXELS 10.0  // continuous scroll distance reported as one wheel step
 
 namespace wma {
 
 /**
  * @brief Wayland-specific mouse/pointer listener implementation
+ *
+ * From wl_pointer v5 the compositor ends each logical group of pointer
+ * events with wl_pointer.frame. Motion, buttons and axes are accumulated
+ * until then and delivered together: the move first, then the buttons in
+ * order, then one scroll carrying both axes. Older pointers flush after
+ * every event.
+ *
+ * Scrolls keep the compositor's precision: wheel steps come from
+ * axis_value120 (v8+, fractions of a notch on high-resolution wheels) or
+ * axis_discrete, touchpad scrolls from the pixel distance, and the
+ * axis source and axis_stop are passed through.
+ *
+ * Relative mode locks the pointer to the surface (zwp_pointer_constraints_v1)
+ * and reads unaccelerated deltas from zwp_relative_pointer_v1, when the
+ * compositor offers both; otherwise it only hides the cursor.
  */
-class WaylandMouseListener : public MouseListener {
+class WaylandMouseListener final : public MouseListener {
 public:
     WaylandMouseListener();
     ~WaylandMouseListener() override;
@@ -17,8 +37,13 @@ public:
     /**
      * @brief Initialize the listener with a Wayland pointer
      * @param pointer The Wayland pointer object
+     * @param surface Window surface the pointer is locked to in relative mode
+     * @param relativePointerManager Relative pointer global, nullptr if not offered
+     * @param pointerConstraints Pointer constraints global, nullptr if not offered
      */
-    void initialize(wl_pointer* pointer);
+    void initialize(wl_pointer* pointer, wl_surface* surface = nullptr,
+                    zwp_relative_pointer_manager_v1* relativePointerManager = nullptr,
+                    zwp_pointer_constraints_v1* pointerConstraints = nullptr);
 
     /**
      * @brief Get the Wayland pointer object
@@ -36,13 +61,64 @@ public:
     void handleAxisSource(uint32_t axis_source);
     void handleAxisStop(uint32_t time, uint32_t axis);
     void handleAxisDiscrete(uint32_t axis, int32_t discrete);
+    void handleAxisValue120(uint32_t axis, int32_t value120);
+    void handleRelativeMotion(u64 utime, wl_fixed_t dxUnaccel, wl_fixed_t dyUnaccel);
 
 protected:
     void updateCursorState() override;
 
 private:
+    // Pointer state accumulated up to the next wl_pointer.frame
+    struct PointerFrame {
+        enum WMAFlags : u32 {
+            WMANone = 0,
+            WMAMotion = 1 << 0,
+            WMAAxis = 1 << 1,          // Continuous axis value, per axis below
+            WMAAxisValue120 = 1 << 2,  // Wheel steps, per axis below
+            WMAAxisStop = 1 << 3
+        };
+
+        struct ButtonEvent {
+            i32 button;
+            bool pressed;
+            u64 timestamp;
+        };
+
+        u32 flags = WMANone;
+        u64 timestamp = 0;                 // Latest motion / axis time of the frame (InputClock ns)
+        f64 x = 0.0;
+        f64 y = 0.0;
+        std::array<f64, 2> axis{};       // Pixels, indexed by wl_pointer axis (vertical, horizontal)
+        std::array<i32, 2> value120{};   // 120 per notch; axis_discrete is scaled up to it
+        std::array<bool, 2> hasValue120{};
+        WMAScrollSource source = WMAScrollSourceUnknown;
+        std::array<ButtonEvent, MouseButton::WMAButtonCount> buttons{};
+        u32 buttonCount = 0;
+    };
+
     wl_pointer* pointer_ = nullptr;
     wl_surface* cursorSurface_ = nullptr;
+    uint32_t enterSerial_ = 0;  // wl_pointer.set_cursor needs the serial of the latest enter
+
+    // Relative mode; the globals belong to the window manager
+    wl_surface* surface_ = nullptr;
+    zwp_relative_pointer_manager_v1* relativePointerManager_ = nullptr;
+    zwp_pointer_constraints_v1* pointerConstraints_ = nullptr;
+    zwp_relative_pointer_v1* relativePointer_ = nullptr;
+    zwp_locked_pointer_v1* lockedPointer_ = nullptr;
+    InputClockMapper relativeClock_{1000, 64};  // relative_motion carries 64-bit microseconds
+
+    PointerFrame frame_;
+    bool frameEvents_ = false;  // The compositor sends wl_pointer.frame (v5+)
+
+    void flushFrame();
+    void setPointerLock(bool locked);
+    // Without frame events every event is its own frame
+    void endEvent() {
+        if (!frameEvents_) {
+            flushFrame();
+        }
+    }
 
     // Wayland pointer listener callbacks
     static const wl_pointer_listener pointerListener_;
@@ -66,6 +142,16 @@ private:
                                        uint32_t time, uint32_t axis);
     static void handleAxisDiscreteCallback(void* data, wl_pointer* pointer,
                                            uint32_t axis, int32_t discrete);
+#ifdef WL_POINTER_AXIS_VALUE120_SINCE_VERSION
+    static void handleAxisValue120Callback(void* data, wl_pointer* pointer,
+                                           uint32_t axis, int32_t value120);
+#endif
+
+    static const zwp_relative_pointer_v1_listener relativePointerListener_;
+    static void handleRelativeMotionCallback(void* data, zwp_relative_pointer_v1* relativePointer,
+                                             uint32_t utimeHi, uint32_t utimeLo,
+                                             wl_fixed_t dx, wl_fixed_t dy,
+                                             wl_fixed_t dxUnaccel, wl_fixed_t dyUnaccel);
 
     // Helper to convert Wayland button codes
     i32 convertButton(uint32_t waylandButton) const;
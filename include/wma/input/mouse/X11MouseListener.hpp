@@ -4,9 +4,24 @@
 #include "MouseListener.hpp"
 #include <X11/Xlib.h>
 
+#ifdef WMA_ENABLE_XINPUT2
+#include <array>
+
+#define WMA_X11_SCROLL_VALUATORS 4  // smooth scroll axes tracked per master pointer
+#endif
+
 namespace wma {
 
-class X11MouseListener : public MouseListener {
+/**
+ * @brief X11 mouse listener
+ *
+ * Built with WMA_ENABLE_XINPUT2 (libXi found), pointer motion, buttons
+ * and scrolling come from XInput 2.1: scroll valuators give fractional wheel
+ * steps for touchpads and high-resolution wheels, and the core wheel
+ * buttons emulated from them are ignored. Relative mode reads XI_RawMotion;
+ * without XInput2 it only hides and confines the cursor.
+ */
+class X11MouseListener final : public MouseListener {
 public:
     X11MouseListener();
     ~X11MouseListener() override = default;
@@ -14,6 +29,20 @@ public:
     void initialize(Display* display, Window window);
     void handleEvent(const XEvent* event);
 
+    /**
+     * @brief Handle a GenericEvent (XInput2); ignored without XInput2
+     */
+    void handleGenericEvent(XEvent& event);
+
+    /**
+     * @brief Window focus or mapping changed; called by the window manager
+     *
+     * Relative mode only grabs the pointer and reads raw motion while the
+     * window has focus: both are released on focus loss (alt-tab) and taken
+     * again on focus gain or map, which also retries a grab that failed.
+     */
+    void setFocused(bool focused);
+
 protected:
     void updateCursorState() override;
 
@@ -21,9 +50,36 @@ private:
     Display* display_ = nullptr;
     Window x11Window_ = 0;
     Cursor invisibleCursor_;
+    bool focused_ = false;
+    bool pointerGrabbed_ = false;  // XGrabPointer succeeded and was not released since
 
     Cursor createInvisibleCursor(Display* display, Window window);
     i32 convertButton(i32 x11Button) const;
+
+    // Buttons 4-7 are the wheel (6 and 7 scroll sideways)
+    static bool isWheelButton(i32 x11Button) { return x11Button >= Button4 && x11Button <= 7; }
+    void dispatchWheel(i32 x11Button, u64 timestamp);
+
+#ifdef WMA_ENABLE_XINPUT2
+    struct ScrollValuator {
+        i32 number = -1;      // Valuator index on the master pointer
+        bool vertical = true;
+        f64 increment = 1.0;  // Valuator distance of one wheel step, negative for natural scrolling
+        f64 value = 0.0;      // Last value seen; scroll valuators only ever accumulate
+    };
+
+    i32 xiOpcode_ = -1;       // XInputExtension major opcode, -1 without XInput 2.1
+    i32 xiPointer_ = -1;      // Master pointer the valuators below belong to
+    std::array<ScrollValuator, WMA_X11_SCROLL_VALUATORS> scrollValuators_;
+    u32 scrollValuatorCount_ = 0;
+
+    void initializeXInput2();
+    void refreshScrollValuators(i32 deviceId);
+    void handleXIMotion(const void* deviceEvent);
+    void handleXIButton(const void* deviceEvent, bool pressed);
+    void handleXIRawMotion(const void* rawEvent);
+    void selectRawMotion(bool enabled);
+#endif
 };
 
 } // namespace wma
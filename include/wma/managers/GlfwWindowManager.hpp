@@ -6,6 +6,7 @@
 #include "wma/input/mouse/GLFWMouseListener.hpp"
 #include "wma/input/keyboard/GLFWKeyboardListener.hpp"
 #include "IWindowManager.hpp"
+#include "wma/core/FrameTimer.hpp"
 
 // Forward declarations
 struct GLFWwindow;
@@ -21,7 +22,7 @@ namespace wma {
      * Provides window management using GLFW backend with support
      * for Vulkan, OpenGL, and CPU rendering.
      */
-    class GlfwWindowManager : public IWindowManager {
+    class GlfwWindowManager final : public IWindowManager {
     public:
         /**
          * @brief Construct GLFW window manager
@@ -40,19 +41,31 @@ namespace wma {
         GlfwWindowManager(const GlfwWindowManager&) = delete;
         GlfwWindowManager& operator=(const GlfwWindowManager&) = delete;
         
-        // Movable
-        GlfwWindowManager(GlfwWindowManager&&) noexcept;
-        GlfwWindowManager& operator=(GlfwWindowManager&&) noexcept;
+        // Non-movable: posted user events and listener callbacks are tied to this instance
+        GlfwWindowManager(GlfwWindowManager&&) = delete;
+        GlfwWindowManager& operator=(GlfwWindowManager&&) = delete;
         
         // IWindowManager interface implementation
         void createWindow(const char* windowName) override;
+        // Frame body inlined, every step statically dispatched (this class is final)
+        template <typename F>
+        void process(F&& actions) {
+            runFrameLoop(*this, actions);
+        }
         void process(std::function<void()>&& actions) override;
+        bool waitIfIdle() override;
+        void pollEvents() override;
+        bool waitEvents(i32 timeoutMs = -1) override;
+        void beginFrame() override;
+        void endFrame() override;
+        void requestRedraw() override;
+        void wake() override;
         void* getWindowInstance() override;
         WindowFlags* getWindowFlags() noexcept override;
         const WindowDetails* getWindowDetails() noexcept override;
         const std::vector<const char*> getVulkanExtensions() const override;
-        KeyboardListener& getKeyboardListener() noexcept override;
-        MouseListener& getMouseListener() noexcept override;
+        GLFWKeyboardListener& getKeyboardListener() noexcept override;
+        GLFWMouseListener& getMouseListener() noexcept override;
         const bool shouldClose() const override;
         WindowBackend getBackendType() const override;
         GraphicsAPI getGraphicsAPI() const override;
@@ -62,13 +75,16 @@ namespace wma {
         GLFWwindow* window_;
         WindowDetails windowDetails_;
         WindowFlags windowFlags_;
+        FrameTimer frameTimer_;
         GraphicsAPI graphicsAPI_;
         std::unique_ptr<GLFWKeyboardListener> keyboardListener_;
         std::unique_ptr<GLFWMouseListener> mouseListener_;
         std::unique_ptr<GlfwUserData> userData_;
         bool windowShouldClose_;
+        bool redrawRequested_;
         
         // Event handling;
+        bool waitForEvents(i32 timeoutMs);
         static void framebufferSizeCallback(GLFWwindow* window, int width, int height);
         static void windowFocusCallback(GLFWwindow* window, int focused);
         static void windowIconifyCallback(GLFWwindow* window, int iconified);
@@ -1,6 +1,7 @@
 #ifndef WMA_MANAGERS_IWINDOW_MANAGER_HPP
 #define WMA_MANAGERS_IWINDOW_MANAGER_HPP
 
+#include <atomic>
 #include <functional>
 #include <vector>
 #include <memory>
@@ -8,11 +9,14 @@
 #include "../core/Types.hpp"
 #include "../core/WindowDetails.hpp"
 #include "../core/WindowFlags.hpp"
+#include "../core/UserEvent.hpp"
 #include "../input/keyboard/KeyboardListener.hpp"
 #include "../input/mouse/MouseListener.hpp"
 
 namespace wma {
 
+    class Reactor;
+
     /**
      * @brief Abstract base interface for window managers
      * 
@@ -22,6 +26,13 @@ namespace wma {
     class IWindowManager {
     public:
         virtual ~IWindowManager() = default;
+
+        // The user event queue and wake flag live here and cannot move: events posted to a moved-from
+        // manager would be lost and a stale wake flag would swallow later wakeups
+        IWindowManager(const IWindowManager&) = delete;
+        IWindowManager& operator=(const IWindowManager&) = delete;
+        IWindowManager(IWindowManager&&) = delete;
+        IWindowManager& operator=(IWindowManager&&) = delete;
         
         /**
          * @brief Create a window with the specified title
@@ -31,10 +42,113 @@ namespace wma {
         
         /**
          * @brief Main event loop processing
+         *
+         * Runs waitIfIdle / beginFrame / pollEvents / actions / endFrame until
+         * shouldClose(). Lambdas resolve to the template overload below; this
+         * type-erased form remains for std::function callers.
+         *
          * @param actions Callback function to execute each frame
          */
         virtual void process(std::function<void()>&& actions) = 0;
 
+        /**
+         * @brief Main event loop processing with the frame body inlined
+         *
+         * Same loop as above, but the callable is a template parameter: no type
+         * erasure and no allocation, so the compiler can inline it into the loop.
+         *
+         * @param actions Callable to execute each frame
+         */
+        template <typename F>
+        void process(F&& actions) {
+            runFrameLoop(*this, actions);
+        }
+
+        /**
+         * @brief Block for events while the window is idle and no redraw was requested
+         *
+         * First step of every process() iteration; waits at most the background
+         * frame interval (see WindowDetails::backgroundFPS).
+         *
+         * @return true if it waited
+         */
+        virtual bool waitIfIdle() = 0;
+
+        /**
+         * @brief Dispatch every pending event to the listeners without blocking
+         */
+        virtual void pollEvents() = 0;
+
+        /**
+         * @brief Block until an event arrives or the timeout expires, then dispatch
+         * @param timeoutMs Maximum wait in ms, -1 to wait indefinitely
+         * @return true if the wait ended because of an event
+         */
+        virtual bool waitEvents(i32 timeoutMs = -1) = 0;
+
+        /**
+         * @brief Start a paced frame (frame timing, OpenGL clear)
+         *
+         * For applications that own their loop: call beginFrame(), then
+         * pollEvents(), render, and endFrame(), as process() does.
+         */
+        virtual void beginFrame() = 0;
+
+        /**
+         * @brief Finish the frame started by beginFrame() (buffer swap, frame pacing)
+         */
+        virtual void endFrame() = 0;
+
+        /**
+         * @brief Render one more frame even if the loop is idle
+         *
+         * Call from the window thread, e.g. from inside process() while an
+         * animation is still running with WindowFlags::idle set.
+         */
+        virtual void requestRedraw() = 0;
+
+        /**
+         * @brief Event loop core the window waits on, for extra fds and timers
+         *
+         * User fds and timers registered here are serviced inside the frame wait.
+         *
+         * @return The reactor, or nullptr when the backend exposes no pollable connection (SDL, GLFW)
+         */
+        virtual Reactor* getReactor() noexcept { return nullptr; }
+
+        /**
+         * @brief Interrupt the current (or next) event or frame wait. Thread-safe.
+         */
+        virtual void wake() = 0;
+
+        /**
+         * @brief Queue an event for the window thread and wake it. Thread-safe, lock-free.
+         *
+         * Posted events are delivered to the user event callback from pollEvents(),
+         * in order per posting thread.
+         *
+         * @param event Payload to deliver
+         * @return false if WMA_USER_EVENT_CAPACITY events are already pending
+         */
+        bool postEvent(const UserEvent& event) {
+            if (!userEvents_.push(event)) {
+                return false;
+            }
+            // One wakeup per batch: the window thread clears the flag before draining.
+            // seq_cst pairs with the consumer's exchange: either it sees this push or we see the cleared flag
+            if (!wakePending_.exchange(true, std::memory_order_seq_cst)) {
+                wake();
+            }
+            return true;
+        }
+
+        /**
+         * @brief Set the callback receiving posted events (window thread)
+         */
+        void setUserEventCallback(UserEventCallback callback) {
+            userEventCallback_ = std::move(callback);
+        }
+
         /**
          * @brief Get current window instance
          */
@@ -97,6 +211,46 @@ namespace wma {
     protected:
         // Protected constructor to prevent direct instantiation
         IWindowManager() = default;
+
+        /**
+         * @brief The frame loop shared by every process() overload
+         *
+         * Templated on the manager so a final backend type dispatches each step statically.
+         */
+        template <typename Manager, typename F>
+        static void runFrameLoop(Manager& manager, F& actions) {
+            while (!manager.shouldClose()) {
+                manager.waitIfIdle();
+
+                manager.beginFrame();
+                manager.pollEvents();
+
+                actions();
+
+                manager.endFrame();
+            }
+        }
+
+        /**
+         * @brief Deliver every posted event; called by the backends from pollEvents()
+         */
+        void dispatchUserEvents() {
+            // An RMW, not a store: a plain release store may pass the queue loads below,
+            // letting a producer see the stale flag and skip wake() for an event we never drain
+            wakePending_.exchange(false, std::memory_order_seq_cst);
+
+            UserEvent event;
+            while (userEvents_.pop(event)) {
+                if (userEventCallback_) {
+                    userEventCallback_(event);
+                }
+            }
+        }
+
+    private:
+        UserEventQueue userEvents_;
+        std::atomic<bool> wakePending_{false};
+        UserEventCallback userEventCallback_;
     };
 
     /**
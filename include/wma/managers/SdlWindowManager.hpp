@@ -6,6 +6,7 @@
 #include "wma/input/mouse/SDLMouseListener.hpp"
 #include "wma/input/keyboard/SDLKeyboardListener.hpp"
 #include "IWindowManager.hpp"
+#include "wma/core/FrameTimer.hpp"
 
 // Forward declarations
 struct SDL_Window;
@@ -20,7 +21,7 @@ namespace wma {
      * Provides window management using SDL2 backend with support
      * for Vulkan, OpenGL, and CPU rendering.
      */
-    class SdlWindowManager : public IWindowManager {
+    class SdlWindowManager final : public IWindowManager {
     public:
         /**
          * @brief Construct SDL window manager
@@ -39,20 +40,32 @@ namespace wma {
         SdlWindowManager(const SdlWindowManager&) = delete;
         SdlWindowManager& operator=(const SdlWindowManager&) = delete;
         
-        // Movable
-        SdlWindowManager(SdlWindowManager&&) noexcept;
-        SdlWindowManager& operator=(SdlWindowManager&&) noexcept;
+        // Non-movable: posted user events and listener callbacks are tied to this instance
+        SdlWindowManager(SdlWindowManager&&) = delete;
+        SdlWindowManager& operator=(SdlWindowManager&&) = delete;
         
         // IWindowManager interface implementation
         void createWindow(const char* windowName) override;
+        // Frame body inlined, every step statically dispatched (this class is final)
+        template <typename F>
+        void process(F&& actions) {
+            runFrameLoop(*this, actions);
+        }
         void process(std::function<void()>&& actions) override;
+        bool waitIfIdle() override;
+        void pollEvents() override;
+        bool waitEvents(i32 timeoutMs = -1) override;
+        void beginFrame() override;
+        void endFrame() override;
+        void requestRedraw() override;
+        void wake() override;
         void* getWindowInstance() override;
         u32 getSDLWindowFlags() const;
         WindowFlags* getWindowFlags() noexcept override;
         const WindowDetails* getWindowDetails() noexcept override;
         const std::vector<const char*> getVulkanExtensions() const override;
-        KeyboardListener& getKeyboardListener() noexcept override;
-        MouseListener& getMouseListener() noexcept override;
+        SDLKeyboardListener& getKeyboardListener() noexcept override;
+        SDLMouseListener& getMouseListener() noexcept override;
         const bool shouldClose() const override;
         WindowBackend getBackendType() const override;
         GraphicsAPI getGraphicsAPI() const override;
@@ -62,13 +75,17 @@ namespace wma {
         SDL_Window* window_;
         WindowDetails windowDetails_;
         WindowFlags windowFlags_;
+        FrameTimer frameTimer_;
         GraphicsAPI graphicsAPI_;
         std::unique_ptr<SDLKeyboardListener> keyboardListener_;
         std::unique_ptr<SDLMouseListener> mouseListener_;
         bool windowShouldClose_;
+        bool redrawRequested_;
+        u32 wakeEventType_; // Registered SDL event type pushed by wake()
         
         // Event handling
         void processEvents();
+        bool waitForEvents(i32 timeoutMs);
         void handleWindowEvent(const SDL_Event* event);
         
         // Helper methods
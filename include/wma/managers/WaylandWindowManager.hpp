@@ -7,6 +7,15 @@
 #include "wma/input/keyboard/WaylandKeyboardListener.hpp"
 #include "wma/managers/xdg-shell-client-protocol.h"
 #include "IWindowManager.hpp"
+#include "wma/core/FrameTimer.hpp"
+#include "wma/core/Reactor.hpp"
+
+// Highest wl_seat version the input listeners handle: v4 repeat_info, v5 pointer frames, v8 axis_value120
+#ifdef WL_POINTER_AXIS_VALUE120_SINCE_VERSION
+#define WMA_WL_SEAT_VERSION 8u
+#else
+#define WMA_WL_SEAT_VERSION 5u
+#endif
 
 namespace wma {
 
@@ -16,7 +25,7 @@ namespace wma {
  * Provides window management using Wayland protocol with support
  * for Vulkan, OpenGL, and CPU rendering.
  */
-class WaylandWindowManager : public IWindowManager {
+class WaylandWindowManager final : public IWindowManager {
 public:
     /**
      * @brief Construct Wayland window manager
@@ -35,19 +44,32 @@ public:
     WaylandWindowManager(const WaylandWindowManager&) = delete;
     WaylandWindowManager& operator=(const WaylandWindowManager&) = delete;
 
-    // Movable
-    WaylandWindowManager(WaylandWindowManager&&) noexcept;
-    WaylandWindowManager& operator=(WaylandWindowManager&&) noexcept;
+    // Non-movable: posted user events and listener callbacks are tied to this instance
+    WaylandWindowManager(WaylandWindowManager&&) = delete;
+    WaylandWindowManager& operator=(WaylandWindowManager&&) = delete;
 
     // IWindowManager interface implementation
     void createWindow(const char* windowName) override;
+    // Frame body inlined, every step statically dispatched (this class is final)
+    template <typename F>
+    void process(F&& actions) {
+        runFrameLoop(*this, actions);
+    }
     void process(std::function<void()>&& actions) override;
+    bool waitIfIdle() override;
+    void pollEvents() override;
+    bool waitEvents(i32 timeoutMs = -1) override;
+    void beginFrame() override;
+    void endFrame() override;
+    void requestRedraw() override;
+    void wake() override;
     void* getWindowInstance() override;
     WindowFlags* getWindowFlags() noexcept override;
     const WindowDetails* getWindowDetails() noexcept override;
     const std::vector<const char*> getVulkanExtensions() const override;
-    KeyboardListener& getKeyboardListener() noexcept override;
-    MouseListener& getMouseListener() noexcept override;
+    WaylandKeyboardListener& getKeyboardListener() noexcept override;
+    WaylandMouseListener& getMouseListener() noexcept override;
+    Reactor* getReactor() noexcept override;
     const bool shouldClose() const override;
     WindowBackend getBackendType() const override;
     GraphicsAPI getGraphicsAPI() const override;
@@ -78,6 +100,10 @@ private:
     xdg_surface* xdgSurface_;
     xdg_toplevel* xdgToplevel_;
 
+    // Relative mouse mode (optional globals)
+    zwp_relative_pointer_manager_v1* relativePointerManager_;
+    zwp_pointer_constraints_v1* pointerConstraints_;
+
     // Input devices
     wl_keyboard* keyboard_;
     wl_pointer* pointer_;
@@ -85,13 +111,18 @@ private:
     // Window state
     WindowDetails windowDetails_;
     WindowFlags windowFlags_;
+    FrameTimer frameTimer_;
     GraphicsAPI graphicsAPI_;
     bool windowShouldClose_;
+    bool redrawRequested_;
 
     // Input listeners
     std::unique_ptr<WaylandKeyboardListener> keyboardListener_;
     std::unique_ptr<WaylandMouseListener> mouseListener_;
 
+    // Display fd + user fds/timers
+    std::unique_ptr<Reactor> reactor_;
+
     // Registry listener for global objects
     static const wl_registry_listener registryListener_;
     static void handleRegistryGlobal(void* data, wl_registry* registry,
@@ -118,6 +149,9 @@ private:
 
     // Event processing
     void processEvents();
+    bool waitForEvents(i32 timeoutMs);
+    void waitForEventsUntil(Reactor::Clock::time_point wakeTarget);
+    u32 readDisplay(Reactor::Clock::time_point deadline);
     void setupInputDevices();
 };
 
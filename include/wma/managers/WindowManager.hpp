@@ -0,0 +1,115 @@
+#ifndef WMA_MANAGERS_WINDOW_MANAGER_HPP
+#define WMA_MANAGERS_WINDOW_MANAGER_HPP
+
+#include <memory>
+
+#include "IWindowManager.hpp"
+
+#ifdef WMA_ENABLE_GLFW
+#include "GlfwWindowManager.hpp"
+#endif
+
+#ifdef WMA_ENABLE_SDL
+#include "SdlWindowManager.hpp"
+#endif
+
+#ifdef WMA_ENABLE_WAYLAND
+#include "WaylandWindowManager.hpp"
+#endif
+
+#ifdef WMA_ENABLE_X11
+#include "X11WindowManager.hpp"
+#endif
+
+namespace wma {
+
+    /**
+     * @brief Concrete types of a backend, specialized for every compiled-in backend
+     */
+    template <WindowBackend Backend>
+    struct BackendTraits;
+
+#ifdef WMA_ENABLE_GLFW
+    template <>
+    struct BackendTraits<WindowBackend::GLFW> {
+        using Manager = GlfwWindowManager;
+        using Keyboard = GLFWKeyboardListener;
+        using Mouse = GLFWMouseListener;
+    };
+#endif
+
+#ifdef WMA_ENABLE_SDL
+    template <>
+    struct BackendTraits<WindowBackend::SDL2> {
+        using Manager = SdlWindowManager;
+        using Keyboard = SDLKeyboardListener;
+        using Mouse = SDLMouseListener;
+    };
+#endif
+
+#ifdef WMA_ENABLE_WAYLAND
+    template <>
+    struct BackendTraits<WindowBackend::WAYLAND> {
+        using Manager = WaylandWindowManager;
+        using Keyboard = WaylandKeyboardListener;
+        using Mouse = WaylandMouseListener;
+    };
+#endif
+
+#ifdef WMA_ENABLE_X11
+    template <>
+    struct BackendTraits<WindowBackend::X11> {
+        using Manager = X11WindowManager;
+        using Keyboard = X11KeyboardListener;
+        using Mouse = X11MouseListener;
+    };
+#endif
+
+    /**
+     * @brief Statically dispatched window manager for a compile-time backend
+     *
+     * The backend classes are final, so every call made through this type
+     * (process, the frame steps, the listeners it returns) binds at compile
+     * time. Use createWindowManager(WindowBackend, ...) when the backend is
+     * only known at runtime.
+     */
+    template <WindowBackend Backend>
+    using WindowManager = typename BackendTraits<Backend>::Manager;
+
+#if defined(WMA_ENABLE_GLFW) || defined(WMA_ENABLE_SDL) || defined(WMA_ENABLE_WAYLAND) || defined(WMA_ENABLE_X11)
+
+    /**
+     * @brief Backend picked at compile time, same priority as getDefaultBackend()
+     */
+#ifdef WMA_ENABLE_GLFW
+    constexpr WindowBackend DefaultBackend = WindowBackend::GLFW;
+#elif defined(WMA_ENABLE_SDL)
+    constexpr WindowBackend DefaultBackend = WindowBackend::SDL2;
+#elif defined(WMA_ENABLE_WAYLAND)
+    constexpr WindowBackend DefaultBackend = WindowBackend::WAYLAND;
+#else
+    constexpr WindowBackend DefaultBackend = WindowBackend::X11;
+#endif
+
+    using DefaultWindowManager = WindowManager<DefaultBackend>;
+
+    /**
+     * @brief Create a statically dispatched window manager
+     * @tparam Backend Compiled-in backend, the compile-time default if omitted
+     * @param windowDetails Window configuration
+     * @param graphicsAPI Graphics API to use
+     * @return Unique pointer to the concrete window manager
+     */
+    template <WindowBackend Backend = DefaultBackend>
+    std::unique_ptr<WindowManager<Backend>> createWindowManager(
+        const WindowDetails& windowDetails,
+        GraphicsAPI graphicsAPI
+        ) {
+        return std::make_unique<WindowManager<Backend>>(windowDetails, graphicsAPI);
+    }
+
+#endif
+
+} // namespace wma
+
+#endif // WMA_MANAGERS_WINDOW_MANAGER_HPP
@@ -8,6 +8,11 @@
 #include "wma/input/mouse/X11MouseListener.hpp"
 #include "wma/input/keyboard/X11KeyboardListener.hpp"
 #include "IWindowManager.hpp"
+#include "wma/core/FrameTimer.hpp"
+
+#ifdef __linux__
+#include "wma/core/Reactor.hpp"
+#endif
 
 namespace wma {
 
@@ -16,8 +21,12 @@ namespace wma {
  *
  * Provides window management using X11 backend with support
  * for Vulkan, OpenGL, and CPU rendering.
+ *
+ * Waits on an epoll Reactor on Linux; other Xlib platforms (*BSD,
+ * Solaris) poll() the display connection and a wakeup pipe, and
+ * getReactor() returns nullptr there.
  */
-class X11WindowManager : public IWindowManager
+class X11WindowManager final : public IWindowManager
 {
 public:
     /**
@@ -37,19 +46,32 @@ public:
     X11WindowManager(const X11WindowManager&) = delete;
     X11WindowManager& operator=(const X11WindowManager&) = delete;
 
-    // Movable
-    X11WindowManager(X11WindowManager&&) noexcept;
-    X11WindowManager& operator=(X11WindowManager&&) noexcept;
+    // Non-movable: posted user events and listener callbacks are tied to this instance
+    X11WindowManager(X11WindowManager&&) = delete;
+    X11WindowManager& operator=(X11WindowManager&&) = delete;
 
     // IWindowManager interface implementation
     void createWindow(const char* windowName) override;
+    // Frame body inlined, every step statically dispatched (this class is final)
+    template <typename F>
+    void process(F&& actions) {
+        runFrameLoop(*this, actions);
+    }
     void process(std::function<void()>&& actions) override;
+    bool waitIfIdle() override;
+    void pollEvents() override;
+    bool waitEvents(i32 timeoutMs = -1) override;
+    void beginFrame() override;
+    void endFrame() override;
+    void requestRedraw() override;
+    void wake() override;
     void* getWindowInstance() override;
     WindowFlags* getWindowFlags() noexcept override;
     const WindowDetails* getWindowDetails() noexcept override;
     const std::vector<const char*> getVulkanExtensions() const override;
-    KeyboardListener& getKeyboardListener() noexcept override;
-    MouseListener& getMouseListener() noexcept override;
+    X11KeyboardListener& getKeyboardListener() noexcept override;
+    X11MouseListener& getMouseListener() noexcept override;
+    Reactor* getReactor() noexcept override;  // nullptr outside Linux
     const bool shouldClose() const override;
     WindowBackend getBackendType() const override;
     GraphicsAPI getGraphicsAPI() const override;
@@ -62,13 +84,24 @@ private:
 
     WindowDetails windowDetails_;
     WindowFlags windowFlags_;
+    FrameTimer frameTimer_;
     GraphicsAPI graphicsAPI_;
     std::unique_ptr<X11KeyboardListener> keyboardListener_;
     std::unique_ptr<X11MouseListener> mouseListener_;
+#ifdef __linux__
+    std::unique_ptr<Reactor> reactor_;
+#else
+    i32 wakePipe_[2];  // Read end polled next to the display fd, written by wake()
+#endif
     bool windowShouldClose_;
+    bool redrawRequested_;
 
     // Event handling
     void processEvents();
+    void dispatchEvent(XEvent& event);
+    bool waitForEvents(i32 timeoutMs);
+    void waitForEventsUntil(FrameTimer::Clock::time_point wakeTarget);
+    u32 waitReady(FrameTimer::Clock::time_point deadline);  // ReactorEvent mask
     void handleWindowEvent(const XEvent* event);
 };
 
@@ -19,6 +19,12 @@
 #include "core/Types.hpp"
 #include "core/WindowDetails.hpp"
 #include "core/WindowFlags.hpp"
+#include "core/FrameStats.hpp"
+#include "core/Reactor.hpp"
+#include "core/UserEvent.hpp"
+#include "core/InplaceFunction.hpp"
+#include "core/InputClock.hpp"
+#include "core/LatencyHistogram.hpp"
 
 // Exception handling
 #include "exceptions/WMAException.hpp"
@@ -48,6 +54,9 @@
 #include "managers/X11WindowManager.hpp"
 #endif
 
+// Compile-time backend selection
+#include "managers/WindowManager.hpp"
+
 /*====================
  * WMA VERSION INFO
  *====================*/
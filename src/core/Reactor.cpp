@@ -0,0 +1,306 @@
+#ifdef __linux__
+#include "wma/core/Reactor.hpp"
+#include "wma/exceptions/WMAException.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+namespace wma {
+
+namespace {
+
+    std::string systemError(const char* what)
+    {
+        return std::string(what) + ": " + std::strerror(errno);
+    }
+
+    timespec toTimespec(std::chrono::nanoseconds ns)
+    {
+        timespec ts;
+        ts.tv_sec = static_cast<time_t>(ns.count() / 1000000000);
+        ts.tv_nsec = static_cast<long>(ns.count() % 1000000000);
+        return ts;
+    }
+
+    std::chrono::nanoseconds fromMs(f64 ms)
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::duration<f64, std::milli>(ms));
+    }
+
+    // Drain a counter fd (eventfd / timerfd); false if it was not ready
+    bool drain(i32 fd)
+    {
+        u64 value;
+        return read(fd, &value, sizeof(value)) == sizeof(value);
+    }
+
+} // namespace
+
+Reactor::Reactor()
+    : epollFd_(-1)
+    , wakeFd_(-1)
+    , deadlineFd_(-1)
+    , displayFd_(-1)
+{
+    epollFd_ = epoll_create1(EPOLL_CLOEXEC);
+    wakeFd_ = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    deadlineFd_ = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+
+    if (epollFd_ < 0 || wakeFd_ < 0 || deadlineFd_ < 0) {
+        const std::string message = systemError("Failed to create reactor");
+        release();
+        throw WMAException(message);
+    }
+
+    try {
+        control(EPOLL_CTL_ADD, wakeFd_, EPOLLIN);
+        control(EPOLL_CTL_ADD, deadlineFd_, EPOLLIN);
+    } catch (...) {
+        release();
+        throw;
+    }
+}
+
+Reactor::~Reactor()
+{
+    release();
+}
+
+void Reactor::setDisplayFd(i32 fd)
+{
+    if (displayFd_ >= 0) {
+        control(EPOLL_CTL_DEL, displayFd_, 0);
+    }
+
+    displayFd_ = fd;
+
+    if (displayFd_ >= 0) {
+        control(EPOLL_CTL_ADD, displayFd_, EPOLLIN);
+    }
+}
+
+void Reactor::addFd(i32 fd, u32 events, FdCallback callback)
+{
+    if (fd < 0 || fd == displayFd_ || watches_.count(fd)) {
+        throw WMAException("Reactor: invalid or already watched fd " + std::to_string(fd));
+    }
+
+    const u32 serial = nextSerial_++;
+    control(EPOLL_CTL_ADD, fd, events, serial);
+
+    Watch& watch = watches_[fd];
+    watch.fdCallback = std::move(callback);
+    watch.serial = serial;
+}
+
+void Reactor::modifyFd(i32 fd, u32 events)
+{
+    auto it = watches_.find(fd);
+    control(EPOLL_CTL_MOD, fd, events, it != watches_.end() ? it->second.serial : 0);
+}
+
+void Reactor::removeFd(i32 fd)
+{
+    auto it = watches_.find(fd);
+    if (it == watches_.end() || it->second.timer) {
+        return;
+    }
+
+    control(EPOLL_CTL_DEL, fd, 0);
+    watches_.erase(it);
+}
+
+i32 Reactor::addTimer(f64 delayMs, f64 intervalMs, TimerCallback callback)
+{
+    const i32 fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+    if (fd < 0) {
+        throw WMAException(systemError("Failed to create reactor timer"));
+    }
+
+    itimerspec spec{};
+    // A zero it_value would disarm the timer instead of firing right away
+    spec.it_value = toTimespec(std::max(fromMs(delayMs), std::chrono::nanoseconds(1)));
+    spec.it_interval = toTimespec(fromMs(INK_MAX(intervalMs, 0.0)));
+
+    if (timerfd_settime(fd, 0, &spec, nullptr) != 0) {
+        const std::string message = systemError("Failed to arm reactor timer");
+        close(fd);
+        throw WMAException(message);
+    }
+
+    // The id is a serial, not the fd: the kernel hands a closed timerfd's number to the next one
+    const u32 serial = nextSerial_++;
+    control(EPOLL_CTL_ADD, fd, EPOLLIN, serial);
+
+    Watch& watch = watches_[fd];
+    watch.timerCallback = std::move(callback);
+    watch.serial = serial;
+    watch.timer = true;
+    watch.periodic = intervalMs > 0.0;
+
+    const i32 timerId = static_cast<i32>(serial);
+    timerFds_[timerId] = fd;
+    return timerId;
+}
+
+void Reactor::cancelTimer(i32 timerId)
+{
+    auto it = timerFds_.find(timerId);
+    if (it != timerFds_.end()) {
+        closeTimer(it->second);
+    }
+}
+
+void Reactor::wake()
+{
+    const u64 one = 1;
+    // EAGAIN means the counter is saturated, i.e. a wakeup is already pending
+    (void)!write(wakeFd_, &one, sizeof(one));
+}
+
+u32 Reactor::wait(Clock::time_point deadline)
+{
+    u32 result = ReactorNone;
+    i32 timeoutMs = -1;
+
+    if (deadline != Clock::time_point::max() && deadline <= Clock::now()) {
+        // Already late: only collect what is ready right now
+        timeoutMs = 0;
+        result |= ReactorTimeout;
+        armDeadline(Clock::time_point::max());
+    } else {
+        armDeadline(deadline);
+    }
+
+    epoll_event events[WMA_REACTOR_MAX_EVENTS];
+    i32 count;
+    do {
+        count = epoll_wait(epollFd_, events, WMA_REACTOR_MAX_EVENTS, timeoutMs);
+    } while (count < 0 && errno == EINTR);
+
+    if (count < 0) {
+        throw WMAException(systemError("epoll_wait failed"));
+    }
+
+    for (i32 i = 0; i < count; ++i) {
+        const i32 fd = static_cast<i32>(static_cast<u32>(events[i].data.u64));
+        const u32 serial = static_cast<u32>(events[i].data.u64 >> 32);
+
+        if (fd == wakeFd_) {
+            drain(wakeFd_);
+            result |= ReactorWakeup;
+        } else if (fd == deadlineFd_) {
+            if (drain(deadlineFd_)) {
+                result |= ReactorTimeout;
+            }
+        } else if (fd == displayFd_) {
+            result |= ReactorDisplay;
+        } else {
+            dispatch(fd, serial, events[i].events);
+            result |= ReactorDispatched;
+        }
+    }
+
+    return result;
+}
+
+u32 Reactor::wait(i32 timeoutMs)
+{
+    return wait(deadlineFromTimeout(timeoutMs));
+}
+
+Reactor::Clock::time_point Reactor::deadlineFromTimeout(i32 timeoutMs)
+{
+    if (timeoutMs < 0) {
+        return Clock::time_point::max();
+    }
+    return Clock::now() + std::chrono::milliseconds(timeoutMs);
+}
+
+void Reactor::control(i32 op, i32 fd, u32 events, u32 serial)
+{
+    epoll_event event{};
+    event.events = events;
+    event.data.u64 = (static_cast<u64>(serial) << 32) | static_cast<u32>(fd);
+
+    if (epoll_ctl(epollFd_, op, fd, &event) != 0) {
+        throw WMAException(systemError("epoll_ctl failed"));
+    }
+}
+
+void Reactor::armDeadline(Clock::time_point deadline)
+{
+    // Re-arming also resets the expiration count, so a deadline missed by the last wait never leaks into this one
+    itimerspec spec{};
+    if (deadline != Clock::time_point::max()) {
+        spec.it_value = toTimespec(std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch()));
+    }
+    timerfd_settime(deadlineFd_, TFD_TIMER_ABSTIME, &spec, nullptr);
+}
+
+void Reactor::dispatch(i32 fd, u32 serial, u32 events)
+{
+    auto it = watches_.find(fd);
+    if (it == watches_.end() || it->second.serial != serial) {
+        return; // Removed by an earlier callback of this batch, or its fd number now belongs to a newer watch
+    }
+
+    if (!it->second.timer) {
+        // Copy: the callback may remove its own watch
+        FdCallback callback = it->second.fdCallback;
+        callback(events);
+        return;
+    }
+
+    if (!drain(fd)) {
+        return;
+    }
+
+    TimerCallback callback = it->second.timerCallback;
+    if (!it->second.periodic) {
+        closeTimer(fd);
+    }
+    callback();
+}
+
+void Reactor::closeTimer(i32 fd)
+{
+    auto it = watches_.find(fd);
+    if (it != watches_.end()) {
+        timerFds_.erase(static_cast<i32>(it->second.serial));
+        watches_.erase(it);
+    }
+    control(EPOLL_CTL_DEL, fd, 0);
+    close(fd);
+}
+
+void Reactor::release()
+{
+    for (auto& [fd, watch] : watches_) {
+        if (watch.timer) {
+            close(fd);
+        }
+    }
+    watches_.clear();
+    timerFds_.clear();
+
+    if (deadlineFd_ >= 0) close(deadlineFd_);
+    if (wakeFd_ >= 0) close(wakeFd_);
+    if (epollFd_ >= 0) close(epollFd_);
+
+    deadlineFd_ = -1;
+    wakeFd_ = -1;
+    epollFd_ = -1;
+    displayFd_ = -1;
+}
+
+} // namespace wma
+
+#endif // __linux__
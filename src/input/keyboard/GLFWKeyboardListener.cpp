@@ -2,7 +2,6 @@
 #include "wma/input/keyboard/GLFWKeyboardListener.hpp"
 #include "wma/input/keyboard/Keys.h"
 #include "wma/exceptions/WMAException.hpp"
-#include "wma/input/KeyboardListener.hpp"
 
 #include <GLFW/glfw3.h>
 
@@ -42,15 +41,13 @@ void GLFWKeyboardListener::initialize(GLFWwindow* window)
 void GLFWKeyboardListener::handleKeyEvent(i32 key, i32 action)
 {
     Key mappedKey = mapGLFWKey(key);
-    auto it = keyActions_.find(static_cast<i32>(mappedKey));
+    // GLFW passes no event times: the callback runs while glfwPollEvents reads the event
+    const u64 timestamp = inputTimeNow();
 
-    if (it != keyActions_.end()) {
-        if (action == GLFW_PRESS) {
-            it->second.executePress();
-        } else if (action == GLFW_RELEASE) {
-            it->second.executeRelease();
-        }
-        // Note: GLFW_REPEAT can be handled here if needed
+    if (action == GLFW_PRESS || action == GLFW_REPEAT) {
+        dispatchKeyPress(mappedKey, timestamp, action == GLFW_REPEAT);
+    } else if (action == GLFW_RELEASE) {
+        dispatchKeyRelease(mappedKey, timestamp);
     }
 }
 
@@ -67,10 +64,7 @@ GLFWKeyboardListener* GLFWKeyboardListener::getInstanceFromWindow(GLFWwindow* wi
     if (!window) return nullptr;
 
     auto* userData = static_cast<GlfwUserData*>(glfwGetWindowUserPointer(window));
-    if (!userData || !userData->keyboardListener) return nullptr;
-
-    // Cast the base pointer to derived type
-    return dynamic_cast<GLFWKeyboardListener*>(userData->keyboardListener);
+    return userData ? userData->keyboardListener : nullptr;
 }
 
 } // namespace wma
@@ -1,21 +1,49 @@
-#include "wma/input/KeyboardListener.hpp"
+#include "wma/input/keyboard/KeyboardListener.hpp"
+#include "wma/exceptions/WMAException.hpp"
+
+#include <string>
 
 namespace wma {
 
 void KeyboardListener::addKeyAction(i32 key, KeyAction action) {
+    if (static_cast<u32>(key) >= static_cast<u32>(KEY_COUNT)) {
+        throw InputException("Invalid key code " + std::to_string(key));
+    }
+
     keyActions_[key] = std::move(action);
+    boundKeys_.set(key);
 }
 
 void KeyboardListener::removeKeyAction(i32 key) {
-    keyActions_.erase(key);
+    if (static_cast<u32>(key) >= static_cast<u32>(KEY_COUNT)) {
+        return;
+    }
+
+    keyActions_[key] = KeyAction();
+    boundKeys_.reset(key);
 }
 
 void KeyboardListener::clearKeyActions() {
-    keyActions_.clear();
+    keyActions_.fill(KeyAction());
+    boundKeys_.reset();
 }
 
 bool KeyboardListener::hasKeyAction(i32 key) const {
-    return keyActions_.find(key) != keyActions_.end();
+    return findKeyAction(key) != nullptr;
+}
+
+void KeyboardListener::setKeyState(i32 key, bool down) {
+    const size_t index = stateIndex(key);
+    if (index == KEY_COUNT || keysDown_[index] == down) {
+        return;
+    }
+
+    keysDown_[index] = down;
+    if (down) {
+        keysPressed_.set(index);
+    } else {
+        keysReleased_.set(index);
+    }
 }
 
 } // namespace wma
@@ -26,14 +26,12 @@ void SDLKeyboardListener::initialize(SDL_Window* window)
 void SDLKeyboardListener::handleKeyEvent(const SDL_KeyboardEvent& keyEvent)
 {
     Key mappedKey = mapSDLKey(keyEvent.keysym.sym);
-    auto it = keyActions_.find(static_cast<i32>(mappedKey));
-
-    if (it != keyActions_.end()) {
-        if (keyEvent.type == SDL_KEYDOWN) {
-            it->second.executePress();
-        } else if (keyEvent.type == SDL_KEYUP) {
-            it->second.executeRelease();
-        }
+    const u64 timestamp = deviceClock_.map(keyEvent.timestamp);
+
+    if (keyEvent.type == SDL_KEYDOWN) {
+        dispatchKeyPress(mappedKey, timestamp, keyEvent.repeat != 0);
+    } else if (keyEvent.type == SDL_KEYUP) {
+        dispatchKeyRelease(mappedKey, timestamp);
     }
 }
 
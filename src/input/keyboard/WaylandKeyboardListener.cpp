@@ -1,13 +1,32 @@
 #include "wma/input/keyboard/WaylandKeyboardListener.hpp"
-#include "wma/input/Keys.h"
+#include "wma/input/keyboard/Keys.h"
 #include "wma/exceptions/WMAException.hpp"
 
+#include <cstring>
 #include <unistd.h>
 #include <sys/mman.h>
 #include <xkbcommon/xkbcommon.h>
 
 namespace wma {
 
+namespace {
+
+    // xkb keycodes are evdev codes + 8
+    constexpr u32 XKB_EVDEV_OFFSET = 8;
+
+    // FNV-1a; keymaps are a few dozen KB, hashing one is far cheaper than compiling it
+    u64 hashKeymap(const char* text, u32 size)
+    {
+        u64 hash = 14695981039346656037ull;
+        for (u32 i = 0; i < size; ++i) {
+            hash ^= static_cast<u8>(text[i]);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+} // namespace
+
 // Static keyboard listener implementation
 const wl_keyboard_listener WaylandKeyboardListener::keyboardListener_ = {
     .keymap = handleKeymapCallback,
@@ -21,32 +40,135 @@ const wl_keyboard_listener WaylandKeyboardListener::keyboardListener_ = {
 WaylandKeyboardListener::WaylandKeyboardListener()
     : KeyboardListener()
     , keyboard_(nullptr)
+    , keyTable_(detail::evdevKeyTable)
 {
+    xkbContext_ = xkb_context_new(XKB_CONTEXT_NO_FLAGS);
+    if (!xkbContext_) {
+        throw InputException("Failed to create xkb context");
+    }
 }
 
 WaylandKeyboardListener::~WaylandKeyboardListener()
 {
+    stopRepeat();
+
     if (keyboard_) {
         wl_keyboard_destroy(keyboard_);
         keyboard_ = nullptr;
     }
+
+    if (xkbState_) xkb_state_unref(xkbState_);
+    if (xkbKeymap_) xkb_keymap_unref(xkbKeymap_);
+    for (CachedKeymap& cached : keymapCache_) {
+        if (cached.keymap) xkb_keymap_unref(cached.keymap);
+    }
+    xkb_context_unref(xkbContext_);
 }
 
-void WaylandKeyboardListener::initialize(wl_keyboard* keyboard)
+void WaylandKeyboardListener::initialize(wl_keyboard* keyboard, Reactor* reactor)
 {
     if (!keyboard) {
         throw InputException("Invalid Wayland keyboard pointer");
     }
 
     keyboard_ = keyboard;
+    reactor_ = reactor;
     wl_keyboard_add_listener(keyboard_, &keyboardListener_, this);
 }
 
 void WaylandKeyboardListener::handleKeymap(uint32_t format, int32_t fd, uint32_t size)
 {
-    // This would typically set up XKB keymap for key translation
-    // For now, we'll close the fd as we're handling basic key codes
+    if (format != WL_KEYBOARD_KEYMAP_FORMAT_XKB_V1 || size == 0) {
+        // No keymap: keep translating evdev codes by physical position
+        close(fd);
+        return;
+    }
+
+    // wl_keyboard v7+ requires MAP_PRIVATE, and it works with every version
+    void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
     close(fd);
+    if (mapped == MAP_FAILED) {
+        return;
+    }
+
+    // The keymap is NUL terminated inside size
+    const char* text = static_cast<const char*>(mapped);
+    xkb_keymap* keymap = findOrCompileKeymap(text, static_cast<u32>(strnlen(text, size)));
+    munmap(mapped, size);
+
+    if (keymap) {
+        setKeymap(keymap);
+    }
+}
+
+xkb_keymap* WaylandKeyboardListener::findOrCompileKeymap(const char* text, u32 size)
+{
+    const u64 hash = hashKeymap(text, size);
+
+    for (const CachedKeymap& cached : keymapCache_) {
+        if (cached.keymap && cached.hash == hash && cached.size == size) {
+            return cached.keymap;
+        }
+    }
+
+    xkb_keymap* keymap = xkb_keymap_new_from_buffer(xkbContext_, text, size,
+                                                    XKB_KEYMAP_FORMAT_TEXT_V1,
+                                                    XKB_KEYMAP_COMPILE_NO_FLAGS);
+    if (!keymap) {
+        return nullptr;
+    }
+
+    // Round robin eviction; the active keymap holds its own reference
+    CachedKeymap& slot = keymapCache_[keymapCacheNext_];
+    keymapCacheNext_ = (keymapCacheNext_ + 1) % WMA_XKB_KEYMAP_CACHE_SIZE;
+
+    if (slot.keymap) {
+        xkb_keymap_unref(slot.keymap);
+    }
+    slot.hash = hash;
+    slot.size = size;
+    slot.keymap = keymap;
+
+    return keymap;
+}
+
+void WaylandKeyboardListener::setKeymap(xkb_keymap* keymap)
+{
+    if (keymap == xkbKeymap_) {
+        return;
+    }
+
+    xkb_state* state = xkb_state_new(keymap);
+    if (!state) {
+        return;
+    }
+
+    if (xkbState_) xkb_state_unref(xkbState_);
+    if (xkbKeymap_) xkb_keymap_unref(xkbKeymap_);
+
+    xkbKeymap_ = xkb_keymap_ref(keymap);
+    xkbState_ = state;
+    xkbLayout_ = 0;
+
+    rebuildKeyTable();
+}
+
+void WaylandKeyboardListener::rebuildKeyTable()
+{
+    // Keys whose keysym in this layout has no Key (e.g. non-Latin letters) keep their physical mapping
+    keyTable_ = detail::evdevKeyTable;
+
+    for (u32 evdevKey = 0; evdevKey < keyTable_.size(); ++evdevKey) {
+        const xkb_keysym_t* syms = nullptr;
+        const i32 count = xkb_keymap_key_get_syms_by_level(xkbKeymap_, evdevKey + XKB_EVDEV_OFFSET,
+                                                           xkbLayout_, 0, &syms);
+        if (count > 0) {
+            const Key key = mapKeysym(syms[0]);
+            if (key != KEY_UNKNOWN) {
+                keyTable_[evdevKey] = static_cast<i8>(key);
+            }
+        }
+    }
 }
 
 void WaylandKeyboardListener::handleEnter(uint32_t serial, wl_surface* surface, wl_array* keys)
@@ -57,24 +179,66 @@ void WaylandKeyboardListener::handleEnter(uint32_t serial, wl_surface* surface,
 
 void WaylandKeyboardListener::handleLeave(uint32_t serial, wl_surface* surface)
 {
-    // Called when keyboard focus leaves our surface
-    // Can be used to release all pressed keys
+    // Called when keyboard focus leaves our surface: no release events will follow
+    stopRepeat();
+    releaseAllKeys();
 }
 
 void WaylandKeyboardListener::handleKey(uint32_t serial, uint32_t time, uint32_t key, uint32_t state)
 {
-    // Wayland sends Linux evdev key codes (offset by 8)
-    // Convert to our unified key enum
-    uint32_t xkbKeycode = key + 8;
-    Key mappedKey = mapWaylandKey(xkbKeycode);
-
-    auto it = keyActions_.find(static_cast<i32>(mappedKey));
-    if (it != keyActions_.end()) {
-        if (state == WL_KEYBOARD_KEY_STATE_PRESSED) {
-            it->second.executePress();
-        } else if (state == WL_KEYBOARD_KEY_STATE_RELEASED) {
-            it->second.executeRelease();
+    // Wayland sends Linux evdev key codes (the xkb keycode minus 8)
+    Key mappedKey = key < keyTable_.size() ? static_cast<Key>(keyTable_[key]) : KEY_UNKNOWN;
+    const u64 timestamp = deviceClock_.map(time);
+
+    if (state == WL_KEYBOARD_KEY_STATE_PRESSED) {
+        dispatchKeyPress(mappedKey, timestamp);
+        if (mappedKey != KEY_UNKNOWN) {
+            startRepeat(key);
+        }
+    } else if (state == WL_KEYBOARD_KEY_STATE_RELEASED) {
+        if (key == repeatKey_) {
+            stopRepeat();
+        }
+        dispatchKeyRelease(mappedKey, timestamp);
+    }
+}
+
+void WaylandKeyboardListener::startRepeat(u32 evdevKey)
+{
+    // Like other clients, only the most recently pressed key repeats
+    stopRepeat();
+
+    if (!reactor_ || repeatRate_ <= 0) {
+        return;
+    }
+
+    // Modifiers and the like do not repeat; the keymap says which keys do
+    if (xkbKeymap_ && !xkb_keymap_key_repeats(xkbKeymap_, evdevKey + XKB_EVDEV_OFFSET)) {
+        return;
+    }
+
+    repeatKey_ = evdevKey;
+    repeatIntervalNs_ = static_cast<u64>(1e9 / repeatRate_);
+    repeatDue_ = inputTimeNow() + static_cast<u64>(repeatDelay_) * 1000000;
+    repeatTimer_ = reactor_->addTimer(repeatDelay_, 1000.0 / repeatRate_, [this]() {
+        // Stamped with the expiry that fired, so the key latency counts how late the loop ran it.
+        // Expirations missed by a stalled loop collapse into one repeat rather than a burst.
+        const u64 now = inputTimeNow();
+        if (now > repeatDue_) {
+            repeatDue_ += (now - repeatDue_) / repeatIntervalNs_ * repeatIntervalNs_;
         }
+        const u64 timestamp = INK_MIN(repeatDue_, now);
+        repeatDue_ += repeatIntervalNs_;
+
+        dispatchKeyPress(keyTable_[repeatKey_], timestamp, true);
+    });
+}
+
+void WaylandKeyboardListener::stopRepeat()
+{
+    if (repeatTimer_ >= 0) {
+        reactor_->cancelTimer(repeatTimer_);
+        repeatTimer_ = -1;
     }
 }
 
@@ -82,15 +246,30 @@ void WaylandKeyboardListener::handleModifiers(uint32_t serial, uint32_t mods_dep
                                               uint32_t mods_latched, uint32_t mods_locked,
                                               uint32_t group)
 {
-    // Handle modifier keys (Shift, Ctrl, Alt, etc.)
-    // This would typically update XKB state for proper key interpretation
+    if (!xkbState_) {
+        return;
+    }
+
+    xkb_state_update_mask(xkbState_, mods_depressed, mods_latched, mods_locked, 0, 0, group);
+
+    // A layout switch changes what the keys mean; plain modifiers do not (Key is the unshifted key)
+    const u32 layout = xkb_state_serialize_layout(xkbState_, XKB_STATE_LAYOUT_EFFECTIVE);
+    if (layout != xkbLayout_) {
+        xkbLayout_ = layout;
+        rebuildKeyTable();
+    }
 }
 
 void WaylandKeyboardListener::handleRepeatInfo(int32_t rate, int32_t delay)
 {
-    // Handle key repeat configuration
-    // rate: characters per second
-    // delay: milliseconds before repeat starts
+    // rate: repeats per second (0 disables repeat), delay: milliseconds before repeat starts
+    repeatRate_ = INK_MAX(rate, 0);
+    repeatDelay_ = INK_MAX(delay, 0);
+
+    // A key already repeating picks the new timing up on its next press
+    if (repeatRate_ == 0) {
+        stopRepeat();
+    }
 }
 
 // Static callback implementations
@@ -3,12 +3,16 @@
 #include "wma/input/keyboard/Keys.h"
 #include "wma/exceptions/WMAException.hpp"
 
+#include <X11/XKBlib.h>
+#include <X11/Xutil.h>
+
 namespace wma {
 
 X11KeyboardListener::X11KeyboardListener()
     : KeyboardListener()
     , display_(nullptr)
 {
+    keycodeTable_.fill(static_cast<i8>(KEY_UNKNOWN));
 }
 
 void X11KeyboardListener::initialize(Display* display)
@@ -18,19 +22,74 @@ void X11KeyboardListener::initialize(Display* display)
     }
 
     display_ = display;
+    if (!rebuildKeymap()) {
+        throw InputException("Failed to read the X11 keyboard mapping");
+    }
+
+    // Per client setting; servers without XKB leave supported False and keep sending release/press pairs
+    Bool supported = False;
+    XkbSetDetectableAutoRepeat(display_, True, &supported);
+    detectableAutoRepeat_ = supported == True;
+}
+
+bool X11KeyboardListener::rebuildKeymap()
+{
+    i32 minKeycode = 0;
+    i32 maxKeycode = 0;
+    XDisplayKeycodes(display_, &minKeycode, &maxKeycode);
+
+    i32 symsPerKeycode = 0;
+    KeySym* keysyms = XGetKeyboardMapping(display_, static_cast<KeyCode>(minKeycode),
+                                          maxKeycode - minKeycode + 1, &symsPerKeycode);
+    if (!keysyms) {
+        return false;
+    }
+
+    // Built aside and swapped in whole, so a failed read above leaves the current layout working
+    std::array<i8, 256> table;
+    table.fill(static_cast<i8>(KEY_UNKNOWN));
+
+    for (i32 keycode = minKeycode; keycode <= maxKeycode; ++keycode) {
+        const KeySym* row = keysyms + (keycode - minKeycode) * symsPerKeycode;
+        KeySym keysym = symsPerKeycode > 0 ? row[0] : NoSymbol;
+
+        // Like XLookupKeysym: a key listing only one keysym reports its lowercase form in column 0
+        if (symsPerKeycode < 2 || row[1] == NoSymbol) {
+            KeySym upper;
+            XConvertCase(keysym, &keysym, &upper);
+        }
+
+        table[keycode & 0xff] = static_cast<i8>(mapX11Key(keysym));
+    }
+
+    XFree(keysyms);
+    keycodeTable_ = table;
+    return true;
 }
 
-void X11KeyboardListener::handleKeyEvent(KeySym x11Key, const XKeyEvent& xKeyEvent)
+void X11KeyboardListener::handleKeyEvent(const XKeyEvent& xKeyEvent)
 {
-    Key mappedKey = mapX11Key(x11Key);
-    auto it = keyActions_.find(static_cast<i32>(mappedKey));
-
-    if (it != keyActions_.end()) {
-        if (xKeyEvent.type == KeyPress) {
-            it->second.executePress();
-        } else if (xKeyEvent.type == KeyRelease) {
-            it->second.executeRelease();
+    Key mappedKey = static_cast<Key>(keycodeTable_[xKeyEvent.keycode & 0xff]);
+    const u64 timestamp = deviceClock_.map(xKeyEvent.time);
+
+    if (xKeyEvent.type == KeyPress) {
+        // Detectable auto repeat: repeats are presses of a key that is already down
+        dispatchKeyPress(mappedKey, timestamp, isKeyDown(mappedKey));
+    } else if (xKeyEvent.type == KeyRelease) {
+        if (!detectableAutoRepeat_ && XEventsQueued(display_, QueuedAfterReading) > 0) {
+            // A repeat's synthetic pair carries one timestamp; a real release/press never does
+            XEvent next;
+            XPeekEvent(display_, &next);
+
+            if (next.type == KeyPress && next.xkey.window == xKeyEvent.window &&
+                next.xkey.keycode == xKeyEvent.keycode && next.xkey.time == xKeyEvent.time) {
+                XNextEvent(display_, &next);
+                dispatchKeyPress(mappedKey, timestamp, true);
+                return;
+            }
         }
+
+        dispatchKeyRelease(mappedKey, timestamp);
     }
 }
 
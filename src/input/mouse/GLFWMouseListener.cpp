@@ -48,54 +48,22 @@ void GLFWMouseListener::initialize(GLFWwindow* window)
 
 void GLFWMouseListener::handleButtonEvent(i32 button, i32 action, i32 mods)
 {
-    i32 unifiedButton = convertButton(button);
-
-    if (buttonActions_.find(unifiedButton) != buttonActions_.end()) {
-        PendingEvent event;
-        event.button = unifiedButton;
-
-        if (action == GLFW_PRESS) {
-            event.type = PendingEvent::WMAButtonPress;
-        } else if (action == GLFW_RELEASE) {
-            event.type = PendingEvent::WMAButtonRelease;
-        }
-
-        if (event.type != PendingEvent::WMANone) {
-            processPendingEvents(event);
-        }
+    // GLFW passes no event times: callbacks run while glfwPollEvents reads the event
+    if (action == GLFW_PRESS || action == GLFW_RELEASE) {
+        dispatchButton(convertButton(button), action == GLFW_PRESS, inputTimeNow());
     }
 }
 
 void GLFWMouseListener::handlePositionEvent(f64 xpos, f64 ypos)
 {
-    if (firstMouse_) {
-        lastPosition_ = WMAMousePosition(xpos, ypos);
-        firstMouse_ = false;
-    }
-
-    f64 deltaX = (xpos - lastPosition_.x) * sensitivity_;
-    f64 deltaY = (lastPosition_.y - ypos) * sensitivity_;
-
-    currentPosition_ = WMAMousePosition(xpos, ypos, deltaX, deltaY);
-
-    if (moveAction_.hasMoveAction()) {
-        PendingEvent event;
-        event.type = PendingEvent::WMAMove;
-        event.position = currentPosition_;
-        processPendingEvents(event);
-    }
-
-    lastPosition_ = WMAMousePosition(xpos, ypos);
+    dispatchMotion(xpos, ypos, inputTimeNow());
 }
 
 void GLFWMouseListener::handleScrollEvent(f64 xoffset, f64 yoffset)
 {
-    if (scrollAction_.hasScrollAction()) {
-        PendingEvent event;
-        event.type = PendingEvent::WMAScroll;
-        event.scroll = WMAMouseScroll(xoffset, yoffset);
-        processPendingEvents(event);
-    }
+    WMAMouseScroll scroll(xoffset, yoffset);
+    scroll.timestamp = inputTimeNow();
+    dispatchScroll(scroll);
 }
 
 void GLFWMouseListener::glfwMouseButtonCallback(GLFWwindow* window, i32 button, i32 action, i32 mods)
@@ -127,20 +95,22 @@ GLFWMouseListener* GLFWMouseListener::getInstanceFromWindow(GLFWwindow* window)
     if (!window) return nullptr;
 
     auto* userData = static_cast<GlfwUserData*>(glfwGetWindowUserPointer(window));
-    if (!userData || !userData->mouseListener) return nullptr;
-
-    // Cast the base pointer to derived type
-    return dynamic_cast<GLFWMouseListener*>(userData->mouseListener);
+    return userData ? userData->mouseListener : nullptr;
 }
 
 void GLFWMouseListener::updateCursorState()
 {
     if (glfwWindow_) {
-        if (cursorEnabled_) {
+        if (cursorEnabled_ && !relativeMode_) {
             glfwSetInputMode(glfwWindow_, GLFW_CURSOR, GLFW_CURSOR_NORMAL);
         } else {
             glfwSetInputMode(glfwWindow_, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
         }
+
+        // A disabled cursor already reports unbounded sub-pixel positions; raw motion drops the acceleration
+        if (glfwRawMouseMotionSupported()) {
+            glfwSetInputMode(glfwWindow_, GLFW_RAW_MOUSE_MOTION, relativeMode_ ? GLFW_TRUE : GLFW_FALSE);
+        }
     }
 }
 
@@ -1,4 +1,7 @@
 #include "wma/input/mouse/MouseListener.hpp"
+#include "wma/exceptions/WMAException.hpp"
+
+#include <string>
 
 namespace wma {
 
@@ -22,12 +25,22 @@ MouseListener::~MouseListener() = default;
 
 void MouseListener::addButtonAction(i32 button, MouseAction action)
 {
+    if (static_cast<u32>(button) >= static_cast<u32>(MouseButton::WMAButtonCount)) {
+        throw InputException("Invalid mouse button " + std::to_string(button));
+    }
+
     buttonActions_[button] = std::move(action);
+    boundButtons_.set(button);
 }
 
 void MouseListener::removeButtonAction(i32 button)
 {
-    buttonActions_.erase(button);
+    if (static_cast<u32>(button) >= static_cast<u32>(MouseButton::WMAButtonCount)) {
+        return;
+    }
+
+    buttonActions_[button] = MouseAction();
+    boundButtons_.reset(button);
 }
 
 void MouseListener::setMoveAction(MouseAction action)
@@ -42,7 +55,8 @@ void MouseListener::setScrollAction(MouseAction action)
 
 void MouseListener::clearAllActions()
 {
-    buttonActions_.clear();
+    buttonActions_.fill(MouseAction());
+    boundButtons_.reset();
     moveAction_ = MouseAction(
         [](const WMAMousePosition& pos) {
             // handle move
@@ -57,7 +71,7 @@ void MouseListener::clearAllActions()
 
 bool MouseListener::hasButtonAction(i32 button) const
 {
-    return buttonActions_.find(button) != buttonActions_.end();
+    return findButtonAction(button) != nullptr;
 }
 
 WMAMousePosition MouseListener::getCurrentPosition() const
@@ -88,8 +102,115 @@ f64 MouseListener::getSensitivity() const
     return sensitivity_;
 }
 
+void MouseListener::setRelativeMode(bool enabled)
+{
+    if (relativeMode_ != enabled) {
+        relativeMode_ = enabled;
+        firstMouse_ = true;
+        updateCursorState();
+    }
+}
+
+void MouseListener::setMotionCoalescing(bool enabled)
+{
+    if (coalesceMotion_ == enabled) {
+        return;
+    }
+
+    flushMotion();
+    coalesceMotion_ = enabled;
+    motionSampleCount_.fill(0);
+}
+
+void MouseListener::flushMotion()
+{
+    if (!coalesceMotion_) {
+        return;
+    }
+
+    // Publish what was collected and start collecting into the other buffer
+    const u32 collecting = publishedSamples_ ^ 1;
+    publishedSamples_ = collecting;
+    motionSampleCount_[collecting ^ 1] = 0;
+
+    // Every merged sample waited until now for its callback
+    if (const u32 count = motionSampleCount_[collecting]) {
+        const u64 now = inputTimeNow();
+        for (u32 i = 0; i < count; ++i) {
+            motionLatency_.recordSince(motionSamples_[collecting][i].timestamp, now);
+        }
+    }
+
+    if (!motionPending_) {
+        return;
+    }
+
+    motionPending_ = false;
+    if (moveAction_.hasMoveAction()) {
+        eventTime_ = pendingMotion_.timestamp;
+        moveAction_.executeMove(pendingMotion_);
+    }
+}
+
+void MouseListener::dispatchMotion(f64 xpos, f64 ypos, u64 timestamp)
+{
+    if (firstMouse_) {
+        lastPosition_ = WMAMousePosition(xpos, ypos);
+        firstMouse_ = false;
+    }
+
+    f64 deltaX = (xpos - lastPosition_.x) * sensitivity_;
+    f64 deltaY = (lastPosition_.y - ypos) * sensitivity_;
+
+    currentPosition_ = WMAMousePosition(xpos, ypos, deltaX, deltaY, timestamp);
+    lastPosition_ = WMAMousePosition(xpos, ypos);
+
+    if (!rawMotionActive_) {
+        deliverMotion();
+    }
+}
+
+void MouseListener::dispatchRelativeMotion(f64 dx, f64 dy, u64 timestamp)
+{
+    // Same orientation as the absolute path: up positive
+    currentPosition_.deltaX = dx * sensitivity_;
+    currentPosition_.deltaY = -dy * sensitivity_;
+    currentPosition_.timestamp = timestamp;
+    deliverMotion();
+}
+
+void MouseListener::deliverMotion()
+{
+    if (!coalesceMotion_) {
+        motionLatency_.recordSince(currentPosition_.timestamp);
+        if (moveAction_.hasMoveAction()) {
+            eventTime_ = currentPosition_.timestamp;
+            moveAction_.executeMove(currentPosition_);
+        }
+        return;
+    }
+
+    const u32 collecting = publishedSamples_ ^ 1;
+    u32& count = motionSampleCount_[collecting];
+    motionSamples_[collecting][INK_MIN(count, static_cast<u32>(WMA_MOTION_SAMPLE_CAPACITY - 1))] = currentPosition_;
+    count = INK_MIN(count + 1, static_cast<u32>(WMA_MOTION_SAMPLE_CAPACITY));
+
+    if (motionPending_) {
+        pendingMotion_.deltaX += currentPosition_.deltaX;
+        pendingMotion_.deltaY += currentPosition_.deltaY;
+        pendingMotion_.x = currentPosition_.x;
+        pendingMotion_.y = currentPosition_.y;
+        pendingMotion_.timestamp = currentPosition_.timestamp;  // The latest sample; each sample keeps its own
+    } else {
+        pendingMotion_ = currentPosition_;
+        motionPending_ = true;
+    }
+}
+
 void MouseListener::processPendingEvents(const PendingEvent& event)
 {
+    eventTime_ = event.timestamp;
+
     switch (event.type) {
     case PendingEvent::WMAMove:
         if (moveAction_.hasMoveAction()) {
@@ -103,21 +224,17 @@ void MouseListener::processPendingEvents(const PendingEvent& event)
         }
         break;
 
-    case PendingEvent::WMAButtonPress: {
-        auto it = buttonActions_.find(event.button);
-        if (it != buttonActions_.end()) {
-            it->second.executePress();
+    case PendingEvent::WMAButtonPress:
+        if (const MouseAction* action = findButtonAction(event.button)) {
+            action->executePress();
         }
         break;
-    }
 
-    case PendingEvent::WMAButtonRelease: {
-        auto it = buttonActions_.find(event.button);
-        if (it != buttonActions_.end()) {
-            it->second.executeRelease();
+    case PendingEvent::WMAButtonRelease:
+        if (const MouseAction* action = findButtonAction(event.button)) {
+            action->executeRelease();
         }
         break;
-    }
 
     case PendingEvent::WMANone:
     default:
@@ -34,55 +34,42 @@ void SDLMouseListener::initialize(SDL_Window* window)
 
 void SDLMouseListener::handleEvent(const SDL_Event& event)
 {
+    // SDL stamps events in milliseconds since SDL_Init
+    const u64 timestamp = deviceClock_.map(event.common.timestamp);
+
     switch (event.type) {
     case SDL_MOUSEBUTTONDOWN:
     case SDL_MOUSEBUTTONUP: {
-        i32 unifiedButton = convertButton(event.button.button);
-        auto it = buttonActions_.find(unifiedButton);
-
-        if (it != buttonActions_.end()) {
-            if (event.type == SDL_MOUSEBUTTONDOWN) {
-                it->second.executePress();
-            } else {
-                it->second.executeRelease();
-            }
-        }
+        dispatchButton(convertButton(event.button.button), event.type == SDL_MOUSEBUTTONDOWN, timestamp);
         break;
     }
 
     case SDL_MOUSEMOTION: {
-        if (firstMouse_) {
-            lastPosition_ = WMAMousePosition(
-                static_cast<f64>(event.motion.x),
-                static_cast<f64>(event.motion.y)
-            );
-            firstMouse_ = false;
-        }
-
-        f64 xpos = static_cast<f64>(event.motion.x);
-        f64 ypos = static_cast<f64>(event.motion.y);
-        f64 deltaX = (xpos - lastPosition_.x) * sensitivity_;
-        f64 deltaY = (lastPosition_.y - ypos) * sensitivity_;
-
-        currentPosition_ = WMAMousePosition(xpos, ypos, deltaX, deltaY);
+        dispatchMotion(static_cast<f64>(event.motion.x), static_cast<f64>(event.motion.y), timestamp);
 
-        if (moveAction_.hasMoveAction()) {
-            moveAction_.executeMove(currentPosition_);
+        // Relative mode pins the position; the deltas are in xrel / yrel
+        if (rawMotionActive_) {
+            dispatchRelativeMotion(static_cast<f64>(event.motion.xrel), static_cast<f64>(event.motion.yrel), timestamp);
         }
-
-        lastPosition_ = WMAMousePosition(xpos, ypos);
         break;
     }
 
     case SDL_MOUSEWHEEL: {
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+        // Fractional steps from high-resolution wheels and touchpads
+        WMAMouseScroll scroll(
+            static_cast<f64>(event.wheel.preciseX),
+            static_cast<f64>(event.wheel.preciseY)
+        );
+#else
         WMAMouseScroll scroll(
             static_cast<f64>(event.wheel.x),
             static_cast<f64>(event.wheel.y)
         );
+#endif
+        scroll.timestamp = timestamp;
 
-        if (scrollAction_.hasScrollAction()) {
-            scrollAction_.executeScroll(scroll);
-        }
+        dispatchScroll(scroll);
         break;
     }
 
@@ -94,13 +81,14 @@ void SDLMouseListener::handleEvent(const SDL_Event& event)
 void SDLMouseListener::updateCursorState()
 {
     if (sdlWindow_) {
-        if (cursorEnabled_) {
+        if (cursorEnabled_ && !relativeMode_) {
             SDL_ShowCursor(SDL_ENABLE);
             SDL_SetRelativeMouseMode(SDL_FALSE);
         } else {
             SDL_ShowCursor(SDL_DISABLE);
             SDL_SetRelativeMouseMode(SDL_TRUE);
         }
+        rawMotionActive_ = SDL_GetRelativeMouseMode() == SDL_TRUE;
     }
 }
 
@@ -16,7 +16,14 @@ const wl_pointer_listener WaylandMouseListener::pointerListener_ = {
     .frame = handleFrameCallback,
     .axis_source = handleAxisSourceCallback,
     .axis_stop = handleAxisStopCallback,
-    .axis_discrete = handleAxisDiscreteCallback
+    .axis_discrete = handleAxisDiscreteCallback,
+#ifdef WL_POINTER_AXIS_VALUE120_SINCE_VERSION
+    .axis_value120 = handleAxisValue120Callback
+#endif
+};
+
+const zwp_relative_pointer_v1_listener WaylandMouseListener::relativePointerListener_ = {
+    .relative_motion = handleRelativeMotionCallback
 };
 
 WaylandMouseListener::WaylandMouseListener()
@@ -28,6 +35,8 @@ WaylandMouseListener::WaylandMouseListener()
 
 WaylandMouseListener::~WaylandMouseListener()
 {
+    setPointerLock(false);
+
     if (cursorSurface_) {
         wl_surface_destroy(cursorSurface_);
         cursorSurface_ = nullptr;
@@ -39,14 +48,23 @@ WaylandMouseListener::~WaylandMouseListener()
     }
 }
 
-void WaylandMouseListener::initialize(wl_pointer* pointer)
+void WaylandMouseListener::initialize(wl_pointer* pointer, wl_surface* surface,
+                                      zwp_relative_pointer_manager_v1* relativePointerManager,
+                                      zwp_pointer_constraints_v1* pointerConstraints)
 {
     if (!pointer) {
         throw InputException("Invalid Wayland pointer");
     }
 
     pointer_ = pointer;
+    surface_ = surface;
+    relativePointerManager_ = relativePointerManager;
+    pointerConstraints_ = pointerConstraints;
+    frameEvents_ = wl_pointer_get_version(pointer_) >= WL_POINTER_FRAME_SINCE_VERSION;
     wl_pointer_add_listener(pointer_, &pointerListener_, this);
+
+    // Relative mode may have been requested before the pointer existed
+    updateCursorState();
 }
 
 void WaylandMouseListener::handleEnter(uint32_t serial, wl_surface* surface,
@@ -59,6 +77,12 @@ void WaylandMouseListener::handleEnter(uint32_t serial, wl_surface* surface,
     currentPosition_ = WMAMousePosition(xpos, ypos);
     lastPosition_ = currentPosition_;
     firstMouse_ = true;
+
+    // The cursor image is per enter: hide it again with this serial
+    enterSerial_ = serial;
+    if (!cursorEnabled_ || relativeMode_) {
+        wl_pointer_set_cursor(pointer_, enterSerial_, nullptr, 0, 0);
+    }
 }
 
 void WaylandMouseListener::handleLeave(uint32_t serial, wl_surface* surface)
@@ -69,103 +93,162 @@ void WaylandMouseListener::handleLeave(uint32_t serial, wl_surface* surface)
 
 void WaylandMouseListener::handleMotion(uint32_t time, wl_fixed_t x, wl_fixed_t y)
 {
-    f64 xpos = wl_fixed_to_double(x);
-    f64 ypos = wl_fixed_to_double(y);
-
-    if (firstMouse_) {
-        lastPosition_ = WMAMousePosition(xpos, ypos);
-        firstMouse_ = false;
-    }
-
-    f64 deltaX = (xpos - lastPosition_.x) * sensitivity_;
-    f64 deltaY = (lastPosition_.y - ypos) * sensitivity_;
-
-    currentPosition_ = WMAMousePosition(xpos, ypos, deltaX, deltaY);
-
-    if (moveAction_.hasMoveAction()) {
-        moveAction_.executeMove(currentPosition_);
-    }
-
-    lastPosition_ = WMAMousePosition(xpos, ypos);
+    frame_.flags |= PointerFrame::WMAMotion;
+    frame_.x = wl_fixed_to_double(x);
+    frame_.y = wl_fixed_to_double(y);
+    frame_.timestamp = deviceClock_.map(time);
+    endEvent();
 }
 
 void WaylandMouseListener::handleButton(uint32_t serial, uint32_t time,
                                         uint32_t button, uint32_t state)
 {
+    // Buttons outside the bindable range have no action to run
     i32 unifiedButton = convertButton(button);
-    auto it = buttonActions_.find(unifiedButton);
-
-    if (it != buttonActions_.end()) {
-        if (state == WL_POINTER_BUTTON_STATE_PRESSED) {
-            it->second.executePress();
-        } else if (state == WL_POINTER_BUTTON_STATE_RELEASED) {
-            it->second.executeRelease();
-        }
+    if (static_cast<u32>(unifiedButton) < static_cast<u32>(MouseButton::WMAButtonCount) &&
+        frame_.buttonCount < frame_.buttons.size()) {
+        frame_.buttons[frame_.buttonCount++] = {unifiedButton, state == WL_POINTER_BUTTON_STATE_PRESSED,
+                                                deviceClock_.map(time)};
     }
+    endEvent();
 }
 
 void WaylandMouseListener::handleAxis(uint32_t time, uint32_t axis, wl_fixed_t value)
 {
-    // Axis events for scroll wheel
-    f64 scrollValue = wl_fixed_to_double(value);
-
-    if (scrollAction_.hasScrollAction()) {
-        WMAMouseScroll scroll;
-
-        if (axis == WL_POINTER_AXIS_VERTICAL_SCROLL) {
-            // Normalize scroll value (Wayland uses pixels, we want units)
-            scroll.yOffset = scrollValue > 0 ? -1.0 : 1.0;
-        } else if (axis == WL_POINTER_AXIS_HORIZONTAL_SCROLL) {
-            scroll.xOffset = scrollValue > 0 ? 1.0 : -1.0;
-        }
-
-        scrollAction_.executeScroll(scroll);
+    // Axis events for scroll wheel, summed over the frame (diagonal scrolls carry both axes)
+    if (axis <= WL_POINTER_AXIS_HORIZONTAL_SCROLL) {
+        frame_.flags |= PointerFrame::WMAAxis;
+        frame_.axis[axis] += wl_fixed_to_double(value);
+        frame_.timestamp = deviceClock_.map(time);
     }
+    endEvent();
 }
 
 void WaylandMouseListener::handleFrame()
 {
-    // Frame event groups pointer events together
-    // Can be used for batching updates
+    // Frame event groups pointer events together: deliver the group as one update
+    flushFrame();
+}
+
+void WaylandMouseListener::flushFrame()
+{
+    const PointerFrame frame = frame_;
+    frame_ = PointerFrame();
+
+    // Position first, so button and scroll handlers see where the pointer is
+    if (frame.flags & PointerFrame::WMAMotion) {
+        dispatchMotion(frame.x, frame.y, frame.timestamp);
+    }
+
+    for (u32 i = 0; i < frame.buttonCount; ++i) {
+        dispatchButton(frame.buttons[i].button, frame.buttons[i].pressed, frame.buttons[i].timestamp);
+    }
+
+    if (!(frame.flags & (PointerFrame::WMAAxis | PointerFrame::WMAAxisValue120 | PointerFrame::WMAAxisStop)) ||
+        !scrollAction_.hasScrollAction()) {
+        return;
+    }
+
+    // Wheel steps when the frame has them, otherwise the pixel distance scaled to steps
+    f64 steps[2];
+    for (u32 axis = 0; axis < 2; ++axis) {
+        steps[axis] = frame.hasValue120[axis] ? frame.value120[axis] / 120.0
+                                              : frame.axis[axis] / WMA_WAYLAND_SCROLL_STEP_PIXELS;
+    }
+
+    // Positive wl_pointer values point down / right; WMA scrolls up positive
+    WMAMouseScroll scroll(steps[WL_POINTER_AXIS_HORIZONTAL_SCROLL],
+                          -steps[WL_POINTER_AXIS_VERTICAL_SCROLL]);
+    scroll.pixelX = frame.axis[WL_POINTER_AXIS_HORIZONTAL_SCROLL];
+    scroll.pixelY = -frame.axis[WL_POINTER_AXIS_VERTICAL_SCROLL];
+    scroll.source = frame.source;
+    scroll.stop = (frame.flags & PointerFrame::WMAAxisStop) != 0;
+    scroll.timestamp = frame.timestamp;
+    dispatchScroll(scroll);
 }
 
 void WaylandMouseListener::handleAxisSource(uint32_t axis_source)
 {
-    // Indicates the source of axis events (wheel, finger, continuous)
+    // Indicates the source of axis events (wheel, finger, continuous), once per frame
+    switch (axis_source) {
+    case WL_POINTER_AXIS_SOURCE_WHEEL:      frame_.source = WMAScrollSourceWheel; break;
+    case WL_POINTER_AXIS_SOURCE_FINGER:     frame_.source = WMAScrollSourceFinger; break;
+    case WL_POINTER_AXIS_SOURCE_CONTINUOUS: frame_.source = WMAScrollSourceContinuous; break;
+    case WL_POINTER_AXIS_SOURCE_WHEEL_TILT: frame_.source = WMAScrollSourceWheelTilt; break;
+    default:                                frame_.source = WMAScrollSourceUnknown; break;
+    }
 }
 
 void WaylandMouseListener::handleAxisStop(uint32_t time, uint32_t axis)
 {
-    // Indicates that axis scrolling has stopped
+    // Indicates that axis scrolling has stopped (finger lifted): the point to start kinetic scrolling
+    frame_.flags |= PointerFrame::WMAAxisStop;
+    frame_.timestamp = deviceClock_.map(time);
 }
 
 void WaylandMouseListener::handleAxisDiscrete(uint32_t axis, int32_t discrete)
 {
-    // Discrete scroll steps (e.g., mouse wheel clicks)
-    if (scrollAction_.hasScrollAction()) {
-        WMAMouseScroll scroll;
-
-        if (axis == WL_POINTER_AXIS_VERTICAL_SCROLL) {
-            scroll.yOffset = static_cast<f64>(discrete);
-        } else if (axis == WL_POINTER_AXIS_HORIZONTAL_SCROLL) {
-            scroll.xOffset = static_cast<f64>(discrete);
+    // Discrete scroll steps (e.g., mouse wheel clicks); v5-v7, replaced by axis_value120 from v8
+    handleAxisValue120(axis, discrete * 120);
+}
+
+void WaylandMouseListener::handleAxisValue120(uint32_t axis, int32_t value120)
+{
+    // Wheel movement in 1/120 of a notch; comes before the matching axis event
+    if (axis <= WL_POINTER_AXIS_HORIZONTAL_SCROLL) {
+        frame_.flags |= PointerFrame::WMAAxisValue120;
+        frame_.value120[axis] += value120;
+        frame_.hasValue120[axis] = true;
+    }
+}
+
+void WaylandMouseListener::handleRelativeMotion(u64 utime, wl_fixed_t dxUnaccel, wl_fixed_t dyUnaccel)
+{
+    // Not part of wl_pointer.frame: deliver right away
+    dispatchRelativeMotion(wl_fixed_to_double(dxUnaccel), wl_fixed_to_double(dyUnaccel), relativeClock_.map(utime));
+}
+
+void WaylandMouseListener::setPointerLock(bool locked)
+{
+    if (locked) {
+        if (relativePointer_ || !relativePointerManager_ || !pointerConstraints_ || !surface_) {
+            return;
         }
 
-        scrollAction_.executeScroll(scroll);
+        relativePointer_ = zwp_relative_pointer_manager_v1_get_relative_pointer(relativePointerManager_, pointer_);
+        zwp_relative_pointer_v1_add_listener(relativePointer_, &relativePointerListener_, this);
+
+        // Persistent: the lock comes back by itself when the surface regains pointer focus
+        lockedPointer_ = zwp_pointer_constraints_v1_lock_pointer(pointerConstraints_, surface_, pointer_, nullptr,
+                                                                 ZWP_POINTER_CONSTRAINTS_V1_LIFETIME_PERSISTENT);
+        rawMotionActive_ = true;
+        return;
+    }
+
+    if (lockedPointer_) {
+        zwp_locked_pointer_v1_destroy(lockedPointer_);
+        lockedPointer_ = nullptr;
+    }
+    if (relativePointer_) {
+        zwp_relative_pointer_v1_destroy(relativePointer_);
+        relativePointer_ = nullptr;
     }
+    rawMotionActive_ = false;
 }
 
 void WaylandMouseListener::updateCursorState()
 {
     if (!pointer_) return;
 
-    if (cursorEnabled_) {
+    setPointerLock(relativeMode_);
+
+    if (cursorEnabled_ && !relativeMode_) {
         // Show cursor - would typically load cursor theme and set cursor
         // For now, just set to default arrow cursor
-        // wl_pointer_set_cursor(pointer_, serial, cursorSurface_, hotspot_x, hotspot_y);
+        // wl_pointer_set_cursor(pointer_, enterSerial_, cursorSurface_, hotspot_x, hotspot_y);
     } else {
         // Hide cursor by setting null cursor surface
-        wl_pointer_set_cursor(pointer_, 0, nullptr, 0, 0);
+        wl_pointer_set_cursor(pointer_, enterSerial_, nullptr, 0, 0);
     }
 }
 
@@ -265,4 +348,26 @@ void WaylandMouseListener::handleAxisDiscreteCallback(void* data, wl_pointer* po
     }
 }
 
+#ifdef WL_POINTER_AXIS_VALUE120_SINCE_VERSION
+void WaylandMouseListener::handleAxisValue120Callback(void* data, wl_pointer* pointer,
+                                                      uint32_t axis, int32_t value120)
+{
+    auto* listener = static_cast<WaylandMouseListener*>(data);
+    if (listener) {
+        listener->handleAxisValue120(axis, value120);
+    }
+}
+#endif
+
+void WaylandMouseListener::handleRelativeMotionCallback(void* data, zwp_relative_pointer_v1* relativePointer,
+                                                        uint32_t utimeHi, uint32_t utimeLo,
+                                                        wl_fixed_t dx, wl_fixed_t dy,
+                                                        wl_fixed_t dxUnaccel, wl_fixed_t dyUnaccel)
+{
+    auto* listener = static_cast<WaylandMouseListener*>(data);
+    if (listener) {
+        listener->handleRelativeMotion((static_cast<u64>(utimeHi) << 32) | utimeLo, dxUnaccel, dyUnaccel);
+    }
+}
+
 } // namespace wma
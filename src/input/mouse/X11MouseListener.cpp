@@ -2,6 +2,10 @@
 #include "wma/exceptions/WMAException.hpp"
 #include "wma/core/Types.hpp"
 
+#ifdef WMA_ENABLE_XINPUT2
+#include <X11/extensions/XInput2.h>
+#endif
+
 namespace wma {
 
 X11MouseListener::X11MouseListener()
@@ -39,6 +43,10 @@ void X11MouseListener::initialize(Display* display, Window window)
     currentPosition_ = WMAMousePosition(static_cast<f64>(x), static_cast<f64>(y));
     lastPosition_ = currentPosition_;
     firstMouse_ = true;
+
+#ifdef WMA_ENABLE_XINPUT2
+    initializeXInput2();
+#endif
 }
 
 void X11MouseListener::handleEvent(const XEvent* event)
@@ -48,76 +56,281 @@ void X11MouseListener::handleEvent(const XEvent* event)
     switch (event->type) {
     case ButtonPress: {
         const int btn = event->xbutton.button;
+        const u64 timestamp = deviceClock_.map(event->xbutton.time);
 
-        // Handle scroll wheel
-        if (btn == Button4 || btn == Button5) {
-            f64 scrollX = 0.0;
-            f64 scrollY = 0.0;
-
-            switch (btn) {
-            case Button4: scrollY = +1.0; break; // wheel up
-            case Button5: scrollY = -1.0; break; // wheel down
-            }
-
-            WMAMouseScroll scroll(scrollX, scrollY);
-
-            if (scrollAction_.hasScrollAction()) {
-                scrollAction_.executeScroll(scroll);
+        if (isWheelButton(btn)) {
+#ifdef WMA_ENABLE_XINPUT2
+            // Emulated from the scroll valuators, which already reported this scroll
+            if (scrollValuatorCount_ > 0) {
+                break;
             }
+#endif
+            dispatchWheel(btn, timestamp);
             break;
         }
 
         // Handle normal mouse buttons
-        i32 unifiedButton = convertButton(btn);
-        auto it = buttonActions_.find(unifiedButton);
-        if (it != buttonActions_.end()) {
-            it->second.executePress();
-        }
+        dispatchButton(convertButton(btn), true, timestamp);
         break;
     }
 
     case ButtonRelease: {
         const int btn = event->xbutton.button;
 
-        // Scroll wheel doesn't have release events
-        if (btn >= Button4) {
+        // Scroll wheel releases carry no action
+        if (isWheelButton(btn)) {
             break;
         }
 
-        i32 unifiedButton = convertButton(btn);
-        auto it = buttonActions_.find(unifiedButton);
-        if (it != buttonActions_.end()) {
-            it->second.executeRelease();
-        }
+        dispatchButton(convertButton(btn), false, deviceClock_.map(event->xbutton.time));
         break;
     }
 
     case MotionNotify: {
-        f64 xpos = static_cast<f64>(event->xmotion.x);
-        f64 ypos = static_cast<f64>(event->xmotion.y);
+        // With XInput2 the server sends each event either as XI2 or as core, never both: core
+        // motion still arrives while a core grab is active (relative mode's XGrabPointer)
+        dispatchMotion(static_cast<f64>(event->xmotion.x), static_cast<f64>(event->xmotion.y),
+                       deviceClock_.map(event->xmotion.time));
+        break;
+    }
 
-        if (firstMouse_) {
-            lastPosition_ = WMAMousePosition(xpos, ypos);
-            firstMouse_ = false;
-        }
+    default:
+        break;
+    }
+}
 
-        f64 deltaX = (xpos - lastPosition_.x) * sensitivity_;
-        f64 deltaY = (lastPosition_.y - ypos) * sensitivity_;
+void X11MouseListener::handleGenericEvent(XEvent& event)
+{
+#ifdef WMA_ENABLE_XINPUT2
+    XGenericEventCookie* cookie = &event.xcookie;
+    if (cookie->extension != xiOpcode_ || xiOpcode_ < 0 || !XGetEventData(display_, cookie)) {
+        return;
+    }
 
-        currentPosition_ = WMAMousePosition(xpos, ypos, deltaX, deltaY);
+    switch (cookie->evtype) {
+    case XI_Motion:
+        handleXIMotion(cookie->data);
+        break;
 
-        if (moveAction_.hasMoveAction()) {
-            moveAction_.executeMove(currentPosition_);
-        }
+    case XI_ButtonPress:
+    case XI_ButtonRelease:
+        handleXIButton(cookie->data, cookie->evtype == XI_ButtonPress);
+        break;
 
-        lastPosition_ = WMAMousePosition(xpos, ypos);
+    case XI_RawMotion:
+        handleXIRawMotion(cookie->data);
+        break;
+
+    // Valuators keep counting while the pointer is elsewhere or another device drives it: resync
+    case XI_Enter:
+        refreshScrollValuators(static_cast<const XIEnterEvent*>(cookie->data)->deviceid);
+        break;
+    case XI_DeviceChanged:
+        refreshScrollValuators(static_cast<const XIDeviceChangedEvent*>(cookie->data)->deviceid);
         break;
-    }
 
     default:
         break;
     }
+
+    XFreeEventData(display_, cookie);
+#endif
+}
+
+#ifdef WMA_ENABLE_XINPUT2
+void X11MouseListener::initializeXInput2()
+{
+    i32 firstEvent = 0;
+    i32 firstError = 0;
+    if (!XQueryExtension(display_, "XInputExtension", &xiOpcode_, &firstEvent, &firstError)) {
+        xiOpcode_ = -1;
+        return;
+    }
+
+    // Scroll classes need 2.1
+    i32 major = 2;
+    i32 minor = 1;
+    if (XIQueryVersion(display_, &major, &minor) != Success || major * 10 + minor < 21) {
+        xiOpcode_ = -1;
+        return;
+    }
+
+    // Buttons too: a core ButtonPress would start a core implicit grab, and the drag's motion would
+    // then come as core MotionNotify; selected here, the grab is an XI2 grab and keeps sending XI_Motion
+    unsigned char mask[XIMaskLen(XI_LASTEVENT)] = {};
+    XISetMask(mask, XI_Motion);
+    XISetMask(mask, XI_ButtonPress);
+    XISetMask(mask, XI_ButtonRelease);
+    XISetMask(mask, XI_Enter);
+    XISetMask(mask, XI_DeviceChanged);
+
+    XIEventMask eventMask;
+    eventMask.deviceid = XIAllMasterDevices;
+    eventMask.mask_len = sizeof(mask);
+    eventMask.mask = mask;
+    XISelectEvents(display_, x11Window_, &eventMask, 1);
+
+    // Baseline for the pointer driving this client, so the first scroll is not lost
+    i32 clientPointer = -1;
+    if (XIGetClientPointer(display_, None, &clientPointer)) {
+        refreshScrollValuators(clientPointer);
+    }
+}
+
+void X11MouseListener::refreshScrollValuators(i32 deviceId)
+{
+    xiPointer_ = deviceId;
+    scrollValuatorCount_ = 0;
+
+    i32 deviceCount = 0;
+    XIDeviceInfo* devices = XIQueryDevice(display_, deviceId, &deviceCount);
+    if (!devices) {
+        return;
+    }
+
+    const XIDeviceInfo& device = devices[0];
+    for (i32 i = 0; i < device.num_classes && scrollValuatorCount_ < scrollValuators_.size(); ++i) {
+        if (device.classes[i]->type != XIScrollClass) {
+            continue;
+        }
+
+        const auto* scrollClass = reinterpret_cast<const XIScrollClassInfo*>(device.classes[i]);
+        if (scrollClass->increment == 0.0) {
+            continue;
+        }
+
+        ScrollValuator& valuator = scrollValuators_[scrollValuatorCount_++];
+        valuator.number = scrollClass->number;
+        valuator.vertical = scrollClass->scroll_type == XIScrollTypeVertical;
+        valuator.increment = scrollClass->increment;
+        valuator.value = 0.0;
+
+        // The current value lives in the valuator class of the same number
+        for (i32 j = 0; j < device.num_classes; ++j) {
+            const auto* valuatorClass = reinterpret_cast<const XIValuatorClassInfo*>(device.classes[j]);
+            if (valuatorClass->type == XIValuatorClass && valuatorClass->number == valuator.number) {
+                valuator.value = valuatorClass->value;
+                break;
+            }
+        }
+    }
+
+    XIFreeDeviceInfo(devices);
+}
+
+void X11MouseListener::handleXIMotion(const void* deviceEvent)
+{
+    const auto* event = static_cast<const XIDeviceEvent*>(deviceEvent);
+
+    if (event->deviceid != xiPointer_) {
+        // First event of this pointer: its values are the baseline, not a scroll
+        refreshScrollValuators(event->deviceid);
+    }
+
+    const u64 timestamp = deviceClock_.map(event->time);
+
+    // Scrolling alone moves no pointer
+    if (firstMouse_ || event->event_x != lastPosition_.x || event->event_y != lastPosition_.y) {
+        dispatchMotion(event->event_x, event->event_y, timestamp);
+    }
+
+    // values holds one entry per set mask bit, in valuator order
+    f64 stepsX = 0.0;
+    f64 stepsY = 0.0;
+    const f64* value = event->valuators.values;
+
+    for (i32 number = 0; number < event->valuators.mask_len * 8; ++number) {
+        if (!XIMaskIsSet(event->valuators.mask, number)) {
+            continue;
+        }
+
+        for (u32 i = 0; i < scrollValuatorCount_; ++i) {
+            ScrollValuator& valuator = scrollValuators_[i];
+            if (valuator.number != number) {
+                continue;
+            }
+
+            const f64 steps = (*value - valuator.value) / valuator.increment;
+            valuator.value = *value;
+
+            // Valuators grow downwards / rightwards; WMA scrolls up positive
+            if (valuator.vertical) {
+                stepsY -= steps;
+            } else {
+                stepsX += steps;
+            }
+        }
+        ++value;
+    }
+
+    if (stepsX != 0.0 || stepsY != 0.0) {
+        WMAMouseScroll scroll(stepsX, stepsY);
+        scroll.timestamp = timestamp;
+        dispatchScroll(scroll);
+    }
+}
+
+void X11MouseListener::handleXIButton(const void* deviceEvent, bool pressed)
+{
+    const auto* event = static_cast<const XIDeviceEvent*>(deviceEvent);
+    const i32 btn = event->detail;
+    const u64 timestamp = deviceClock_.map(event->time);
+
+    if (isWheelButton(btn)) {
+        // Wheel buttons emulated from scroll valuators were already reported by XI_Motion
+        if (pressed && !(event->flags & XIPointerEmulated)) {
+            dispatchWheel(btn, timestamp);
+        }
+        return;
+    }
+
+    dispatchButton(convertButton(btn), pressed, timestamp);
+}
+
+void X11MouseListener::handleXIRawMotion(const void* rawEvent)
+{
+    const auto* event = static_cast<const XIRawEvent*>(rawEvent);
+
+    // Already queued when the selection was dropped on focus loss
+    if (!rawMotionActive_) {
+        return;
+    }
+
+    // Valuators 0 and 1 are x and y, before acceleration; raw_values is packed like valuators.values
+    f64 delta[2] = {0.0, 0.0};
+    const f64* value = event->raw_values;
+    for (i32 number = 0; number < 2 && number < event->valuators.mask_len * 8; ++number) {
+        if (XIMaskIsSet(event->valuators.mask, number)) {
+            delta[number] = *value++;
+        }
+    }
+
+    if (delta[0] != 0.0 || delta[1] != 0.0) {
+        dispatchRelativeMotion(delta[0], delta[1], deviceClock_.map(event->time));
+    }
+}
+
+void X11MouseListener::selectRawMotion(bool enabled)
+{
+    if (xiOpcode_ < 0) {
+        return;
+    }
+
+    // Raw events are only delivered to the root window
+    unsigned char mask[XIMaskLen(XI_RawMotion)] = {};
+    if (enabled) {
+        XISetMask(mask, XI_RawMotion);
+    }
+
+    XIEventMask eventMask;
+    eventMask.deviceid = XIAllMasterDevices;
+    eventMask.mask_len = sizeof(mask);
+    eventMask.mask = mask;
+    XISelectEvents(display_, DefaultRootWindow(display_), &eventMask, 1);
+
+    rawMotionActive_ = enabled;
 }
+#endif
 
 Cursor X11MouseListener::createInvisibleCursor(Display* display, Window window)
 {
@@ -136,21 +349,66 @@ void X11MouseListener::updateCursorState()
     if (!display_ || !x11Window_)
         return;
 
-    if (cursorEnabled_) {
+    if (cursorEnabled_ && !relativeMode_) {
         XUndefineCursor(display_, x11Window_);
     } else {
         XDefineCursor(display_, x11Window_, invisibleCursor_);
     }
 
+    // Relative mode keeps the hidden pointer (and its clicks) inside the window while it has focus
+    const bool capture = relativeMode_ && focused_;
+    if (capture && !pointerGrabbed_) {
+        // Fails with GrabNotViewable before the window is mapped, or AlreadyGrabbed; retried by setFocused()
+        pointerGrabbed_ = XGrabPointer(display_, x11Window_, True,
+                                       ButtonPressMask | ButtonReleaseMask | PointerMotionMask,
+                                       GrabModeAsync, GrabModeAsync, x11Window_, invisibleCursor_,
+                                       CurrentTime) == GrabSuccess;
+    } else if (!capture && pointerGrabbed_) {
+        XUngrabPointer(display_, CurrentTime);
+        pointerGrabbed_ = false;
+    }
+
+#ifdef WMA_ENABLE_XINPUT2
+    // Raw events come from the root window for every master pointer: only read them while captured
+    selectRawMotion(capture && pointerGrabbed_);
+#endif
+
     XFlush(display_);
 }
 
+void X11MouseListener::dispatchWheel(i32 x11Button, u64 timestamp)
+{
+    f64 scrollX = 0.0;
+    f64 scrollY = 0.0;
+
+    switch (x11Button) {
+    case Button4: scrollY = +1.0; break; // wheel up
+    case Button5: scrollY = -1.0; break; // wheel down
+    case 6:       scrollX = -1.0; break; // wheel left
+    case 7:       scrollX = +1.0; break; // wheel right
+    }
+
+    WMAMouseScroll scroll(scrollX, scrollY);
+    scroll.source = WMAScrollSourceWheel;
+    scroll.timestamp = timestamp;
+
+    dispatchScroll(scroll);
+}
+
+void X11MouseListener::setFocused(bool focused)
+{
+    focused_ = focused;
+    updateCursorState();
+}
+
 i32 X11MouseListener::convertButton(i32 x11Button) const
 {
     switch (x11Button) {
     case Button1:   return MouseButton::WMALeft;
     case Button2:   return MouseButton::WMAMiddle;
     case Button3:   return MouseButton::WMARight;
+    case 8:         return MouseButton::WMAButton4; // Back (4-7 are the wheels)
+    case 9:         return MouseButton::WMAButton5; // Forward
     default:        return x11Button;
     }
 }
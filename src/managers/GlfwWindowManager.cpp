@@ -17,15 +17,18 @@ namespace wma {
         : window_(nullptr)
         , windowDetails_(windowDetails)
         , windowFlags_{}
+        , frameTimer_(windowFlags_)
         , graphicsAPI_(graphicsAPI)
         , keyboardListener_(std::make_unique<GLFWKeyboardListener>())
         , mouseListener_(std::make_unique<GLFWMouseListener>())
         , userData_(std::make_unique<GlfwUserData>())
         , windowShouldClose_(false)
+        , redrawRequested_(false)
     {
         userData_->windowManager = this;
         userData_->keyboardListener = keyboardListener_.get();
         userData_->mouseListener = mouseListener_.get();
+        frameTimer_.configure(windowDetails_);
         initializeGLFW();
     }
 
@@ -33,57 +36,6 @@ namespace wma {
         destroy();
     }
 
-    GlfwWindowManager::GlfwWindowManager(GlfwWindowManager&& other) noexcept
-        : window_(other.window_)
-        , windowDetails_(std::move(other.windowDetails_))
-        , windowFlags_(std::move(other.windowFlags_))
-        , graphicsAPI_(other.graphicsAPI_)
-        , keyboardListener_(std::move(other.keyboardListener_))
-        , mouseListener_(std::move(other.mouseListener_))
-        , userData_(std::move(other.userData_))
-        , windowShouldClose_(other.windowShouldClose_)
-    {
-        other.window_ = nullptr;
-        if (userData_) {
-            userData_->windowManager = this;
-            userData_->keyboardListener = keyboardListener_.get();
-            userData_->mouseListener = mouseListener_.get();
-        }
-    }
-
-    GlfwWindowManager& GlfwWindowManager::operator=(GlfwWindowManager&& other) noexcept {
-        if (this != &other) {
-            // Clean up current resources
-            if (window_) {
-                glfwDestroyWindow(window_);
-            }
-
-            // Move data
-            window_ = other.window_;
-            windowDetails_ = std::move(other.windowDetails_);
-            windowFlags_ = std::move(other.windowFlags_);
-            graphicsAPI_ = other.graphicsAPI_;
-            keyboardListener_ = std::move(other.keyboardListener_);
-            mouseListener_ = std::move(other.mouseListener_);
-            userData_ = std::move(other.userData_);
-            windowShouldClose_ = other.windowShouldClose_;
-
-            other.window_ = nullptr;
-
-            if (userData_) {
-
-                userData_->windowManager = this;
-                userData_->keyboardListener = keyboardListener_.get();
-                userData_->mouseListener = mouseListener_.get();
-
-                if (window_) {
-                    glfwSetWindowUserPointer(window_, userData_.get());
-                }
-            }
-        }
-        return *this;
-    }
-
     void GlfwWindowManager::createWindow(const char* windowName) {
         // Set window hints
         glfwWindowHint(GLFW_RESIZABLE, windowDetails_.resizable ? GLFW_TRUE : GLFW_FALSE);
@@ -158,24 +110,83 @@ namespace wma {
     }
 
     void GlfwWindowManager::process(std::function<void()>&& actions) {
-        FrameTimer timer(windowFlags_);
-        timer.setTargetFPS(windowDetails_.targetFPS);
+        runFrameLoop(*this, actions);
+    }
 
-        while (!windowShouldClose_ && !glfwWindowShouldClose(window_)) {
-            glfwPollEvents();
+    bool GlfwWindowManager::waitIfIdle() {
+        if (!frameTimer_.shouldIdle() || redrawRequested_) {
+            return false;
+        }
 
-            timer.updateDeltaTime();
-            
-            // Execute user actions
-            actions();
+        waitForEvents(frameTimer_.getIdleTimeoutMs());
+        frameTimer_.markIdle();
+        return true;
+    }
 
-            if (graphicsAPI_ == GraphicsAPI::OpenGL) {
-                glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
-                glfwSwapBuffers(window_);
-            }
+    void GlfwWindowManager::pollEvents() {
+        glfwPollEvents();
+
+        // One coalesced move per frame when motion coalescing is on
+        if (mouseListener_) {
+            mouseListener_->flushMotion();
+        }
+        dispatchUserEvents();
+        frameTimer_.markPhase(FramePhase::PhaseEvents);
+    }
+
+    bool GlfwWindowManager::waitEvents(i32 timeoutMs) {
+        const bool ready = waitForEvents(timeoutMs);
+        if (mouseListener_) {
+            mouseListener_->flushMotion();
+        }
+        dispatchUserEvents();
+        frameTimer_.markPhase(FramePhase::PhaseEvents);
+        return ready;
+    }
+
+    void GlfwWindowManager::beginFrame() {
+        redrawRequested_ = false;
+        frameTimer_.updateDeltaTime();
+
+        if (graphicsAPI_ == GraphicsAPI::OpenGL) {
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+            frameTimer_.markPhase(FramePhase::PhasePresent);
+        }
+    }
+
+    void GlfwWindowManager::endFrame() {
+        frameTimer_.markPhase(FramePhase::PhaseActions);
+
+        // Input handled from here on belongs to the next frame
+        if (keyboardListener_) {
+            keyboardListener_->newFrame();
+        }
 
-            timer.limitFrameRate();
+        if (graphicsAPI_ == GraphicsAPI::OpenGL) {
+            glfwSwapBuffers(window_);
+            frameTimer_.markPhase(FramePhase::PhasePresent);
         }
+
+        frameTimer_.limitFrameRate();
+    }
+
+    void GlfwWindowManager::requestRedraw() {
+        redrawRequested_ = true;
+    }
+
+    void GlfwWindowManager::wake() {
+        // Thread-safe; makes glfwWaitEvents / glfwWaitEventsTimeout return
+        glfwPostEmptyEvent();
+    }
+
+    bool GlfwWindowManager::waitForEvents(i32 timeoutMs) {
+        // GLFW dispatches whatever woke it up through the regular callbacks
+        if (timeoutMs < 0) {
+            glfwWaitEvents();
+        } else {
+            glfwWaitEventsTimeout(timeoutMs / 1000.0);
+        }
+        return true;
     }
 
     void* GlfwWindowManager::getWindowInstance() {
@@ -205,11 +216,11 @@ namespace wma {
 #endif
     }
 
-    KeyboardListener& GlfwWindowManager::getKeyboardListener() noexcept {
+    GLFWKeyboardListener& GlfwWindowManager::getKeyboardListener() noexcept {
         return *keyboardListener_;
     }
 
-    MouseListener& GlfwWindowManager::getMouseListener() noexcept {
+    GLFWMouseListener& GlfwWindowManager::getMouseListener() noexcept {
         return *mouseListener_;
     }
 
@@ -239,6 +250,10 @@ namespace wma {
         if (userData && userData->windowManager) {
             userData->windowManager->windowFlags_.focused = focused == GLFW_TRUE;
         }
+        // Keys released while unfocused never reach us
+        if (userData && userData->keyboardListener && focused != GLFW_TRUE) {
+            userData->keyboardListener->releaseAllKeys();
+        }
     }
 
     void GlfwWindowManager::windowIconifyCallback(GLFWwindow* window, int iconified) {
@@ -18,11 +18,15 @@ namespace wma {
         : window_(nullptr)
         , windowDetails_(windowDetails)
         , windowFlags_{}
+        , frameTimer_(windowFlags_)
         , graphicsAPI_(graphicsAPI)
         , keyboardListener_(std::make_unique<SDLKeyboardListener>())
         , mouseListener_(std::make_unique<SDLMouseListener>())
         , windowShouldClose_(false)
+        , redrawRequested_(false)
+        , wakeEventType_(SDL_USEREVENT)
     {
+        frameTimer_.configure(windowDetails_);
         initializeSDL();
     }
 
@@ -30,39 +34,6 @@ namespace wma {
         destroy();
     }
 
-    SdlWindowManager::SdlWindowManager(SdlWindowManager&& other) noexcept
-        : window_(other.window_)
-        , windowDetails_(std::move(other.windowDetails_))
-        , windowFlags_(std::move(other.windowFlags_))
-        , graphicsAPI_(other.graphicsAPI_)
-        , keyboardListener_(std::move(other.keyboardListener_))
-        , mouseListener_(std::move(other.mouseListener_))
-        , windowShouldClose_(other.windowShouldClose_)
-    {
-        other.window_ = nullptr;
-    }
-
-    SdlWindowManager& SdlWindowManager::operator=(SdlWindowManager&& other) noexcept {
-        if (this != &other) {
-            // Clean up current resources
-            if (window_) {
-                SDL_DestroyWindow(window_);
-            }
-
-            // Move data
-            window_ = other.window_;
-            windowDetails_ = std::move(other.windowDetails_);
-            windowFlags_ = std::move(other.windowFlags_);
-            graphicsAPI_ = other.graphicsAPI_;
-            keyboardListener_ = std::move(other.keyboardListener_);
-            mouseListener_ = std::move(other.mouseListener_);
-            windowShouldClose_ = other.windowShouldClose_;
-
-            other.window_ = nullptr;
-        }
-        return *this;
-    }
-
     void SdlWindowManager::createWindow(const char* windowName) {
         window_ = SDL_CreateWindow(
             windowName,
@@ -110,27 +81,78 @@ namespace wma {
     }
 
     void SdlWindowManager::process(std::function<void()>&& actions) {
-        FrameTimer timer(windowFlags_);
-        timer.setTargetFPS(windowDetails_.targetFPS);
+        runFrameLoop(*this, actions);
+    }
 
-        while (!windowShouldClose_) {
-            timer.updateDeltaTime();
+    bool SdlWindowManager::waitIfIdle() {
+        if (!frameTimer_.shouldIdle() || redrawRequested_) {
+            return false;
+        }
 
-            processEvents();
-            
-            if (graphicsAPI_ == GraphicsAPI::OpenGL) {
-                glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
-            }
+        waitForEvents(frameTimer_.getIdleTimeoutMs());
+        frameTimer_.markIdle();
+        return true;
+    }
 
-            // Execute user actions (draw, update, etc.)
-            actions();
+    void SdlWindowManager::pollEvents() {
+        processEvents();
 
-            if (graphicsAPI_ == GraphicsAPI::OpenGL) {
-                SDL_GL_SwapWindow(window_);
-            }
+        // One coalesced move per frame when motion coalescing is on
+        if (mouseListener_) {
+            mouseListener_->flushMotion();
+        }
+        frameTimer_.markPhase(FramePhase::PhaseEvents);
+    }
+
+    bool SdlWindowManager::waitEvents(i32 timeoutMs) {
+        const bool ready = waitForEvents(timeoutMs);
+        pollEvents();
+        return ready;
+    }
+
+    void SdlWindowManager::beginFrame() {
+        redrawRequested_ = false;
+        frameTimer_.updateDeltaTime();
 
-            timer.limitFrameRate();
+        if (graphicsAPI_ == GraphicsAPI::OpenGL) {
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+            frameTimer_.markPhase(FramePhase::PhasePresent);
+        }
+    }
+
+    void SdlWindowManager::endFrame() {
+        frameTimer_.markPhase(FramePhase::PhaseActions);
+
+        // Input handled from here on belongs to the next frame
+        if (keyboardListener_) {
+            keyboardListener_->newFrame();
         }
+
+        if (graphicsAPI_ == GraphicsAPI::OpenGL) {
+            SDL_GL_SwapWindow(window_);
+            frameTimer_.markPhase(FramePhase::PhasePresent);
+        }
+
+        frameTimer_.limitFrameRate();
+    }
+
+    void SdlWindowManager::requestRedraw() {
+        redrawRequested_ = true;
+    }
+
+    void SdlWindowManager::wake() {
+        // SDL_PushEvent is thread-safe and interrupts SDL_WaitEventTimeout
+        SDL_Event event{};
+        event.type = wakeEventType_;
+        SDL_PushEvent(&event);
+    }
+
+    bool SdlWindowManager::waitForEvents(i32 timeoutMs) {
+        // A null event leaves whatever arrived in the queue for processEvents()
+        if (timeoutMs < 0) {
+            return SDL_WaitEvent(nullptr) == 1;
+        }
+        return SDL_WaitEventTimeout(nullptr, timeoutMs) == 1;
     }
 
     u32 SdlWindowManager::getSDLWindowFlags() const {
@@ -183,11 +205,11 @@ namespace wma {
         return extensions;
     }
 
-    KeyboardListener& SdlWindowManager::getKeyboardListener() noexcept {
+    SDLKeyboardListener& SdlWindowManager::getKeyboardListener() noexcept {
         return *keyboardListener_;
     }
 
-    MouseListener& SdlWindowManager::getMouseListener() noexcept {
+    SDLMouseListener& SdlWindowManager::getMouseListener() noexcept {
         return *mouseListener_;
     }
 
@@ -228,9 +250,12 @@ namespace wma {
                     break;
 
                 default:
+                    // wakeEventType_ only interrupts waits; posted events are drained below
                     break;
             }
         }
+
+        dispatchUserEvents();
     }
 
     void SdlWindowManager::handleWindowEvent(const SDL_Event* event) {
@@ -248,6 +273,8 @@ namespace wma {
                 
             case SDL_WINDOWEVENT_FOCUS_LOST:
                 windowFlags_.focused = false;
+                // Keys released while unfocused never reach us
+                keyboardListener_->releaseAllKeys();
                 break;
                 
             case SDL_WINDOWEVENT_MINIMIZED:
@@ -285,6 +312,11 @@ namespace wma {
             }
         }
 
+        wakeEventType_ = SDL_RegisterEvents(1);
+        if (wakeEventType_ == static_cast<u32>(-1)) {
+            wakeEventType_ = SDL_USEREVENT;
+        }
+
         mouseListener_->setSensitivity(1.0); // Default
     }
 
@@ -3,6 +3,7 @@
 #include "wma/exceptions/WMAException.hpp"
 
 #include <ink/InkAssert.h>
+#include <algorithm>
 #include <cstring>
 
 namespace wma {
@@ -47,15 +48,21 @@ WaylandWindowManager::WaylandWindowManager(const WindowDetails& windowDetails,
     , xdgWmBase_(nullptr)
     , xdgSurface_(nullptr)
     , xdgToplevel_(nullptr)
+    , relativePointerManager_(nullptr)
+    , pointerConstraints_(nullptr)
     , keyboard_(nullptr)
     , pointer_(nullptr)
     , windowDetails_(windowDetails)
     , windowFlags_{}
+    , frameTimer_(windowFlags_)
     , graphicsAPI_(graphicsAPI)
     , windowShouldClose_(false)
+    , redrawRequested_(false)
     , keyboardListener_(std::make_unique<WaylandKeyboardListener>())
     , mouseListener_(std::make_unique<WaylandMouseListener>())
+    , reactor_(std::make_unique<Reactor>())
 {
+    frameTimer_.configure(windowDetails_);
 }
 
 WaylandWindowManager::~WaylandWindowManager()
@@ -63,72 +70,6 @@ WaylandWindowManager::~WaylandWindowManager()
     destroy();
 }
 
-WaylandWindowManager::WaylandWindowManager(WaylandWindowManager&& other) noexcept
-    : display_(other.display_)
-    , registry_(other.registry_)
-    , compositor_(other.compositor_)
-    , surface_(other.surface_)
-    , seat_(other.seat_)
-    , xdgWmBase_(other.xdgWmBase_)
-    , xdgSurface_(other.xdgSurface_)
-    , xdgToplevel_(other.xdgToplevel_)
-    , keyboard_(other.keyboard_)
-    , pointer_(other.pointer_)
-    , windowDetails_(other.windowDetails_)
-    , windowFlags_(other.windowFlags_)
-    , graphicsAPI_(other.graphicsAPI_)
-    , windowShouldClose_(other.windowShouldClose_)
-    , keyboardListener_(std::move(other.keyboardListener_))
-    , mouseListener_(std::move(other.mouseListener_))
-{
-    other.display_ = nullptr;
-    other.registry_ = nullptr;
-    other.compositor_ = nullptr;
-    other.surface_ = nullptr;
-    other.seat_ = nullptr;
-    other.xdgWmBase_ = nullptr;
-    other.xdgSurface_ = nullptr;
-    other.xdgToplevel_ = nullptr;
-    other.keyboard_ = nullptr;
-    other.pointer_ = nullptr;
-}
-
-WaylandWindowManager& WaylandWindowManager::operator=(WaylandWindowManager&& other) noexcept
-{
-    if (this != &other) {
-        destroy();
-
-        display_ = other.display_;
-        registry_ = other.registry_;
-        compositor_ = other.compositor_;
-        surface_ = other.surface_;
-        seat_ = other.seat_;
-        xdgWmBase_ = other.xdgWmBase_;
-        xdgSurface_ = other.xdgSurface_;
-        xdgToplevel_ = other.xdgToplevel_;
-        keyboard_ = other.keyboard_;
-        pointer_ = other.pointer_;
-        windowDetails_ = other.windowDetails_;
-        windowFlags_ = other.windowFlags_;
-        graphicsAPI_ = other.graphicsAPI_;
-        windowShouldClose_ = other.windowShouldClose_;
-        keyboardListener_ = std::move(other.keyboardListener_);
-        mouseListener_ = std::move(other.mouseListener_);
-
-        other.display_ = nullptr;
-        other.registry_ = nullptr;
-        other.compositor_ = nullptr;
-        other.surface_ = nullptr;
-        other.seat_ = nullptr;
-        other.xdgWmBase_ = nullptr;
-        other.xdgSurface_ = nullptr;
-        other.xdgToplevel_ = nullptr;
-        other.keyboard_ = nullptr;
-        other.pointer_ = nullptr;
-    }
-    return *this;
-}
-
 void WaylandWindowManager::createWindow(const char* windowName)
 {
     display_ = wl_display_connect(nullptr);
@@ -164,34 +105,145 @@ void WaylandWindowManager::createWindow(const char* windowName)
     wl_display_roundtrip(display_);
 
     if (seat_) setupInputDevices();
+
+    reactor_->setDisplayFd(wl_display_get_fd(display_));
 }
 
 void WaylandWindowManager::process(std::function<void()>&& actions)
 {
-    FrameTimer timer(windowFlags_);
-    timer.setTargetFPS(windowDetails_.targetFPS);
+    runFrameLoop(*this, actions);
+}
+
+bool WaylandWindowManager::waitIfIdle()
+{
+    if (!frameTimer_.shouldIdle() || redrawRequested_) {
+        return false;
+    }
+
+    waitForEvents(frameTimer_.getIdleTimeoutMs());
+    frameTimer_.markIdle();
+    return true;
+}
+
+void WaylandWindowManager::pollEvents()
+{
+    processEvents();
+
+    // One coalesced move per frame when motion coalescing is on
+    if (mouseListener_) {
+        mouseListener_->flushMotion();
+    }
+    frameTimer_.markPhase(FramePhase::PhaseEvents);
+}
+
+bool WaylandWindowManager::waitEvents(i32 timeoutMs)
+{
+    const bool ready = waitForEvents(timeoutMs);
+    pollEvents();
+    return ready;
+}
 
-    while (!windowShouldClose_) {
-        timer.updateDeltaTime();
+void WaylandWindowManager::beginFrame()
+{
+    redrawRequested_ = false;
+    frameTimer_.updateDeltaTime();
+}
 
-        processEvents();
+void WaylandWindowManager::endFrame()
+{
+    frameTimer_.markPhase(FramePhase::PhaseActions);
 
-        actions();
+    // Input handled from here on (pacing wait, next poll) belongs to the next frame
+    if (keyboardListener_) {
+        keyboardListener_->newFrame();
+    }
 
-        timer.limitFrameRate();
+    // Send the requests queued during the frame (surface commits, acks)
+    wl_display_flush(display_);
+    frameTimer_.markPhase(FramePhase::PhasePresent);
+
+    // Input that arrives while pacing is dispatched right away instead of waiting for the next frame
+    frameTimer_.limitFrameRate([this](Reactor::Clock::time_point wakeTarget) {
+        waitForEventsUntil(wakeTarget);
+    });
+}
+
+void WaylandWindowManager::requestRedraw()
+{
+    redrawRequested_ = true;
+}
+
+void WaylandWindowManager::wake()
+{
+    if (reactor_) {
+        reactor_->wake();
     }
 }
 
+bool WaylandWindowManager::waitForEvents(i32 timeoutMs)
+{
+    const Reactor::Clock::time_point deadline = Reactor::deadlineFromTimeout(timeoutMs);
+
+    for (;;) {
+        const u32 ready = readDisplay(deadline);
+
+        // User fd / timer callbacks may ask for a frame through requestRedraw()
+        if ((ready & (ReactorDisplay | ReactorWakeup)) || redrawRequested_) {
+            return true;
+        }
+        if (ready & ReactorTimeout) {
+            return false;
+        }
+    }
+}
+
+void WaylandWindowManager::waitForEventsUntil(Reactor::Clock::time_point wakeTarget)
+{
+    for (;;) {
+        const u32 ready = readDisplay(wakeTarget);
+
+        if (ready & ReactorDisplay) {
+            wl_display_dispatch_pending(display_);
+        }
+        if (ready & ReactorWakeup) {
+            dispatchUserEvents();
+        }
+        if (ready & ReactorTimeout) {
+            return;
+        }
+    }
+}
+
+u32 WaylandWindowManager::readDisplay(Reactor::Clock::time_point deadline)
+{
+    // Events already in the queue: nothing to wait for
+    if (wl_display_prepare_read(display_) != 0) {
+        return ReactorDisplay;
+    }
+
+    wl_display_flush(display_);
+
+    const u32 ready = reactor_->wait(deadline);
+
+    if (ready & ReactorDisplay) {
+        wl_display_read_events(display_);
+    } else {
+        wl_display_cancel_read(display_);
+    }
+    return ready;
+}
+
 void WaylandWindowManager::processEvents()
 {
     // Dispatch pending events
     wl_display_dispatch_pending(display_);
 
-    // Read events from the display
-    if (wl_display_prepare_read(display_) == 0) {
-        wl_display_read_events(display_);
+    // Read events from the display without blocking; also runs due reactor timers (key repeat) and fd callbacks
+    if (readDisplay(Reactor::Clock::now()) & ReactorDisplay) {
         wl_display_dispatch_pending(display_);
     }
+
+    dispatchUserEvents();
 }
 
 void WaylandWindowManager::setupInputDevices()
@@ -201,12 +253,12 @@ void WaylandWindowManager::setupInputDevices()
 
     // Initialize keyboard listener if keyboard is available
     if (keyboard_) {
-        keyboardListener_->initialize(keyboard_);
+        keyboardListener_->initialize(keyboard_, reactor_.get());
     }
 
     // Initialize mouse listener if pointer is available
     if (pointer_) {
-        mouseListener_->initialize(pointer_);
+        mouseListener_->initialize(pointer_, surface_, relativePointerManager_, pointerConstraints_);
     }
 }
 
@@ -230,16 +282,21 @@ const WindowDetails* WaylandWindowManager::getWindowDetails() noexcept
     return &windowDetails_;
 }
 
-KeyboardListener& WaylandWindowManager::getKeyboardListener() noexcept
+WaylandKeyboardListener& WaylandWindowManager::getKeyboardListener() noexcept
 {
     return *keyboardListener_;
 }
 
-MouseListener& WaylandWindowManager::getMouseListener() noexcept
+WaylandMouseListener& WaylandWindowManager::getMouseListener() noexcept
 {
     return *mouseListener_;
 }
 
+Reactor* WaylandWindowManager::getReactor() noexcept
+{
+    return reactor_.get();
+}
+
 const bool WaylandWindowManager::shouldClose() const
 {
     return windowShouldClose_;
@@ -277,6 +334,15 @@ WmaCode WaylandWindowManager::destroy()
         seat_ = nullptr;
     }
 
+    if (relativePointerManager_) {
+        zwp_relative_pointer_manager_v1_destroy(relativePointerManager_);
+        relativePointerManager_ = nullptr;
+    }
+    if (pointerConstraints_) {
+        zwp_pointer_constraints_v1_destroy(pointerConstraints_);
+        pointerConstraints_ = nullptr;
+    }
+
     // Destroy surface
     if (surface_) {
         wl_surface_destroy(surface_);
@@ -310,6 +376,9 @@ WmaCode WaylandWindowManager::destroy()
 
     // Disconnect from display
     if (display_) {
+        if (reactor_) {
+            reactor_->setDisplayFd(-1);
+        }
         wl_display_disconnect(display_);
         display_ = nullptr;
     }
@@ -335,9 +404,15 @@ void WaylandWindowManager::handleRegistryGlobal(void* data, wl_registry* registr
         xdg_wm_base_add_listener(manager->xdgWmBase_, &xdgWmBaseListener_, manager);
     } else if (strcmp(interface, wl_seat_interface.name) == 0) {
         manager->seat_ = static_cast<wl_seat*>(
-            wl_registry_bind(registry, name, &wl_seat_interface, 1)
+            wl_registry_bind(registry, name, &wl_seat_interface, std::min(version, WMA_WL_SEAT_VERSION))
             );
         wl_seat_add_listener(manager->seat_, &seatListener_, manager);
+    } else if (strcmp(interface, zwp_relative_pointer_manager_v1_interface.name) == 0) {
+        manager->relativePointerManager_ = static_cast<zwp_relative_pointer_manager_v1*>(
+            wl_registry_bind(registry, name, &zwp_relative_pointer_manager_v1_interface, 1));
+    } else if (strcmp(interface, zwp_pointer_constraints_v1_interface.name) == 0) {
+        manager->pointerConstraints_ = static_cast<zwp_pointer_constraints_v1*>(
+            wl_registry_bind(registry, name, &zwp_pointer_constraints_v1_interface, 1));
     }
 }
 
@@ -401,6 +476,16 @@ void WaylandWindowManager::handleXdgToplevelConfigure(void* data, xdg_toplevel*
 {
     auto* manager = static_cast<WaylandWindowManager*>(data);
 
+    // xdg-shell has no minimized state; focus follows the activated state
+    bool activated = false;
+    const auto* state = static_cast<const u32*>(states->data);
+    for (size_t i = 0; i < states->size / sizeof(u32); ++i) {
+        if (state[i] == XDG_TOPLEVEL_STATE_ACTIVATED) {
+            activated = true;
+        }
+    }
+    manager->windowFlags_.focused = activated;
+
     // Width/Height will be 0 if the compositor wants us to decide the size ourselves
     if (width > 0 && height > 0) {
         manager->windowDetails_.width = static_cast<u32>(width);
@@ -5,6 +5,14 @@
 
 #include <ink/InkAssert.h>
 #include <ink/InkException.h>
+#include <ink/Inkogger.h>
+
+#ifndef __linux__
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
 
 namespace wma {
 
@@ -16,16 +24,34 @@ X11WindowManager::X11WindowManager(const WindowDetails& windowDetails,
     , wmDeleteWindow_(0)
     , windowDetails_(windowDetails)
     , windowFlags_{}
+    , frameTimer_(windowFlags_)
     , graphicsAPI_(graphicsAPI)
     , keyboardListener_(std::make_unique<X11KeyboardListener>())
     , mouseListener_(std::make_unique<X11MouseListener>())
+#ifdef __linux__
+    , reactor_(std::make_unique<Reactor>())
+#endif
     , windowShouldClose_(false)
+    , redrawRequested_(false)
 {
-    // Empty
+#ifndef __linux__
+    if (pipe(wakePipe_) != 0) {
+        INK_THROW("Failed to create the X11 wakeup pipe.");
+    }
+    for (const i32 fd : wakePipe_) {
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        fcntl(fd, F_SETFD, FD_CLOEXEC);
+    }
+#endif
+    frameTimer_.configure(windowDetails_);
 }
 
 wma::X11WindowManager::~X11WindowManager() {
     destroy();
+#ifndef __linux__
+    close(wakePipe_[0]);
+    close(wakePipe_[1]);
+#endif
 }
 
 void X11WindowManager::createWindow(const char* windowName)
@@ -42,7 +68,8 @@ void X11WindowManager::createWindow(const char* windowName)
     // receive keyboard, mouse, resize, and exposure events.
     windowAttributes.event_mask = ExposureMask | KeyPressMask | KeyReleaseMask |
                                   ButtonPressMask | ButtonReleaseMask | PointerMotionMask |
-                                  StructureNotifyMask; // For resize events
+                                  FocusChangeMask |
+                                  StructureNotifyMask; // For resize and map/unmap events
 
     window_ = XCreateWindow(display_,
                             rootWindow,
@@ -70,29 +97,206 @@ void X11WindowManager::createWindow(const char* windowName)
     // Map the window to the screen to make it visible.
     XMapWindow(display_, window_);
     XFlush(display_); // Ensure all commands are sent to the X server.
+
+    keyboardListener_->initialize(display_);
+    mouseListener_->initialize(display_, window_);
+
+#ifdef __linux__
+    reactor_->setDisplayFd(ConnectionNumber(display_));
+#endif
 }
 
 void X11WindowManager::process(std::function<void()>&& actions)
 {
-    FrameTimer timer(windowFlags_);
-    timer.setTargetFPS(windowDetails_.targetFPS);
+    runFrameLoop(*this, actions);
+}
+
+bool X11WindowManager::waitIfIdle()
+{
+    if (!frameTimer_.shouldIdle() || redrawRequested_) {
+        return false;
+    }
+
+    waitForEvents(frameTimer_.getIdleTimeoutMs());
+    frameTimer_.markIdle();
+    return true;
+}
+
+void X11WindowManager::pollEvents()
+{
+    processEvents();
+
+    // One coalesced move per frame when motion coalescing is on
+    if (mouseListener_) {
+        mouseListener_->flushMotion();
+    }
+    frameTimer_.markPhase(FramePhase::PhaseEvents);
+}
+
+bool X11WindowManager::waitEvents(i32 timeoutMs)
+{
+    const bool ready = waitForEvents(timeoutMs);
+    pollEvents();
+    return ready;
+}
+
+void X11WindowManager::beginFrame()
+{
+    redrawRequested_ = false;
+    frameTimer_.updateDeltaTime();
+}
+
+void X11WindowManager::endFrame()
+{
+    if (!display_) {
+        return;
+    }
+
+    frameTimer_.markPhase(FramePhase::PhaseActions);
+
+    // Input handled from here on (pacing wait, next poll) belongs to the next frame
+    if (keyboardListener_) {
+        keyboardListener_->newFrame();
+    }
+
+    XFlush(display_);
+    frameTimer_.markPhase(FramePhase::PhasePresent);
+
+    // Input that arrives while pacing is dispatched right away instead of waiting for the next frame
+    frameTimer_.limitFrameRate([this](FrameTimer::Clock::time_point wakeTarget) {
+        waitForEventsUntil(wakeTarget);
+    });
+}
+
+void X11WindowManager::requestRedraw()
+{
+    redrawRequested_ = true;
+}
+
+void X11WindowManager::wake()
+{
+#ifdef __linux__
+    reactor_->wake();
+#else
+    const char one = 1;
+    // EAGAIN means the pipe is full, i.e. a wakeup is already pending
+    (void)!write(wakePipe_[1], &one, sizeof(one));
+#endif
+}
+
+bool X11WindowManager::waitForEvents(i32 timeoutMs)
+{
+    if (!display_) {
+        return false;
+    }
+
+    // Requests queued by the last frame must reach the server before we sleep
+    XFlush(display_);
+
+    if (XPending(display_) > 0) {
+        return true;
+    }
+
+    const FrameTimer::Clock::time_point deadline = timeoutMs < 0
+        ? FrameTimer::Clock::time_point::max()
+        : FrameTimer::Clock::now() + std::chrono::milliseconds(timeoutMs);
+
+    for (;;) {
+        const u32 ready = waitReady(deadline);
+
+        // User fd / timer callbacks may ask for a frame through requestRedraw()
+        if ((ready & (ReactorDisplay | ReactorWakeup)) || redrawRequested_) {
+            return true;
+        }
+        if (ready & ReactorTimeout) {
+            return false;
+        }
+    }
+}
+
+void X11WindowManager::waitForEventsUntil(FrameTimer::Clock::time_point wakeTarget)
+{
+    XFlush(display_);
+
+    // A callback dispatched below may destroy() the window
+    while (display_) {
+        // Events Xlib already read off the socket never make the fd readable
+        if (XEventsQueued(display_, QueuedAlready) > 0) {
+            processEvents();
+        }
+
+        const u32 ready = waitReady(wakeTarget);
+
+        if (ready & (ReactorDisplay | ReactorWakeup)) {
+            processEvents();
+        }
+        if (ready & ReactorTimeout) {
+            return;
+        }
+    }
+}
 
-    while (XPending(display_) > 0) {
-        timer.updateDeltaTime();
+u32 X11WindowManager::waitReady(FrameTimer::Clock::time_point deadline)
+{
+#ifdef __linux__
+    return reactor_->wait(deadline);
+#else
+    // Millisecond poll() timeouts: rounded up, so the frame timer's spin window absorbs the rest
+    i32 timeoutMs = -1;
+    if (deadline != FrameTimer::Clock::time_point::max()) {
+        const auto remaining = deadline - FrameTimer::Clock::now();
+        timeoutMs = remaining.count() > 0
+            ? static_cast<i32>(std::chrono::ceil<std::chrono::milliseconds>(remaining).count())
+            : 0;
+    }
 
-        processEvents();
+    pollfd fds[2] = {};
+    fds[0].fd = ConnectionNumber(display_);
+    fds[0].events = POLLIN;
+    fds[1].fd = wakePipe_[0];
+    fds[1].events = POLLIN;
 
-        actions();
+    const i32 count = poll(fds, 2, timeoutMs);
+    if (count < 0) {
+        return errno == EINTR ? ReactorNone : ReactorTimeout;
+    }
 
-        timer.limitFrameRate();
+    u32 result = ReactorNone;
+    if (fds[0].revents & (POLLIN | POLLHUP | POLLERR)) {
+        result |= ReactorDisplay;
+    }
+    if (fds[1].revents & POLLIN) {
+        char buffer[64];
+        while (read(wakePipe_[0], buffer, sizeof(buffer)) > 0) {
+        }
+        result |= ReactorWakeup;
     }
+    if (count == 0 || FrameTimer::Clock::now() >= deadline) {
+        result |= ReactorTimeout;
+    }
+    return result;
+#endif
 }
 
 void X11WindowManager::processEvents()
 {
-    static XEvent event;
+    XEvent event;
+
+    // QueuedAfterReading pulls whatever the socket holds into Xlib's queue without blocking.
+    // A callback may destroy() the window mid-drain, which closes the display.
+    while (display_ && XEventsQueued(display_, QueuedAfterReading) > 0) {
+        XNextEvent(display_, &event);
+        dispatchEvent(event);
+    }
+
+    dispatchUserEvents();
+}
 
-    XNextEvent(display_, &event);
+void X11WindowManager::dispatchEvent(XEvent& event)
+{
+    if (!display_) {
+        return;
+    }
 
     handleWindowEvent(&event);
 
@@ -103,12 +307,27 @@ void X11WindowManager::processEvents()
             // --- Input Events ---
         case KeyPress:
         case KeyRelease:
-            keyboardListener_->handleKeyEvent(XLookupKeysym(&event.xkey, 0), event.xkey);
+            keyboardListener_->handleKeyEvent(event.xkey);
+            break;
+
+            // Sent to every client when the keyboard layout changes
+        case MappingNotify:
+            XRefreshKeyboardMapping(&event.xmapping);
+            // A failed read keeps the old layout; throwing here would abort event dispatch
+            if (event.xmapping.request == MappingKeyboard && !keyboardListener_->rebuildKeymap()) {
+                INK_LOG << "X11: failed to read the new keyboard mapping, keeping the previous one";
+            }
             break;
 
         case ButtonPress:
-            // std::cout << "Mouse button pressed: " << event.xbutton.button << std::endl;
-            // TODO: Update mouseListener_
+        case ButtonRelease:
+        case MotionNotify:
+            mouseListener_->handleEvent(&event);
+            break;
+
+            // XInput2 (smooth scrolling)
+        case GenericEvent:
+            mouseListener_->handleGenericEvent(event);
             break;
 
             // Fired when the user clicks the window's close button.
@@ -130,7 +349,7 @@ void X11WindowManager::handleWindowEvent(const XEvent* event)
     switch (event->type)
     {
         // Fired on window resize or move.
-        case ResizeRequest:
+        case ConfigureNotify:
         {
             XConfigureEvent xce = event->xconfigure;
             if (xce.width != windowDetails_.width || xce.height != windowDetails_.height) {
@@ -140,6 +359,25 @@ void X11WindowManager::handleWindowEvent(const XEvent* event)
             }
             break;
         }
+        case FocusIn:
+            windowFlags_.focused = true;
+            mouseListener_->setFocused(true);
+            break;
+        case FocusOut:
+            windowFlags_.focused = false;
+            // Keys released while unfocused never reach us
+            keyboardListener_->releaseAllKeys();
+            // Drops a relative mode grab, so alt-tab does not keep turning the camera
+            mouseListener_->setFocused(false);
+            break;
+        case MapNotify:
+            windowFlags_.minimized = false;
+            // Retries a relative mode grab that failed while the window was not viewable
+            mouseListener_->setFocused(windowFlags_.focused);
+            break;
+        case UnmapNotify:
+            windowFlags_.minimized = true;
+            break;
         default:
             break;
     }
@@ -166,16 +404,25 @@ const WindowDetails* X11WindowManager::getWindowDetails() noexcept
     return &windowDetails_;
 }
 
-KeyboardListener& X11WindowManager::getKeyboardListener() noexcept
+X11KeyboardListener& X11WindowManager::getKeyboardListener() noexcept
 {
     return *keyboardListener_;
 }
 
-MouseListener& X11WindowManager::getMouseListener() noexcept
+X11MouseListener& X11WindowManager::getMouseListener() noexcept
 {
     return *mouseListener_;
 }
 
+Reactor* X11WindowManager::getReactor() noexcept
+{
+#ifdef __linux__
+    return reactor_.get();
+#else
+    return nullptr;
+#endif
+}
+
 const bool X11WindowManager::shouldClose() const
 {
     return windowShouldClose_;
@@ -194,6 +441,10 @@ GraphicsAPI X11WindowManager::getGraphicsAPI() const
 WmaCode X11WindowManager::destroy()
 {
     if (display_) {
+#ifdef __linux__
+        reactor_->setDisplayFd(-1);
+#endif
+
         if (window_) {
             XDestroyWindow(display_, window_);
             window_ = 0;
@@ -201,6 +452,8 @@ WmaCode X11WindowManager::destroy()
         XCloseDisplay(display_);
         display_ = nullptr;
     }
+    // Also ends process() when called from a callback inside the loop
+    windowShouldClose_ = true;
     return WmaCode::OK;
 }
 